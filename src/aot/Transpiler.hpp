@@ -0,0 +1,412 @@
+#pragma once
+
+#ifndef AOT_TRANSPILER_HEADER_H_
+#define AOT_TRANSPILER_HEADER_H_
+
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "../optimizer/ProgramImage.hpp"
+#include "../optimizer/Cfg.hpp"
+#include "../interpreter/Aot.hpp"
+
+namespace sbl::aot {
+	using namespace opt;
+
+	struct Stats {
+		size_t regions = 0;
+		size_t entryPoints = 0;
+		size_t inlined = 0;		//Instructions translated into C++
+		size_t performed = 0;	//Instructions run through the runners of the VM
+	};
+
+	/*
+		Translates a program image into a C++ translation unit for SBL_AOT(see interpreter/Aot.hpp)
+
+		The basic blocks of the program are grouped into regions, starting from the entry point
+		and from the targets of the direct calls, each region taking every block reachable from
+		its start by jumps and by falling through that is not in a region yet. Calls are left
+		to the interpreter, so the regions stay small enough for the C++ compiler and a called
+		function is compiled once no matter how many callers it has.
+
+		Every region becomes a function with a label per block. Register moves, arithmetic,
+		tests and the direct and relative jumps are translated into C++, everything else
+		runs through the runners of the VM. A jump to a block of the same region is a goto,
+		any other transfer of control returns to the interpreter, which enters the region
+		of the target, if there is one.
+	*/
+	class Transpiler {
+	public:
+		Transpiler(const ProgramImage& image, const std::vector<uint32_t>& stream)
+			: image(image), stream(stream) {}
+
+		Stats run(std::ostream& out) {
+			nodes = decodeNodes(image);
+			entry = image.entry();
+			cfg.build(nodes, entry);
+			_formRegions();
+
+			out << "//Generated by sbl-aot, do not edit\n"
+				<< "#include \"interpreter/VM.hpp\"\n\n"
+				<< "#ifndef SBL_AOT\n"
+				<< "#	error \"Compiled program images are run by the VM only with SBL_AOT, see interpreter/Config.hpp.\"\n"
+				<< "#endif\n\n"
+				<< "namespace {\n"
+				<< "\tusing sbl::vm::AotFrame;\n"
+				<< "\tusing sbl::cmn::Mnemonic;\n";
+
+			for (size_t r = 0; r < regions.size(); ++r)
+				_emitRegion(out, r);
+
+			_emitModule(out);
+			out << "}\n";
+
+			stats.regions = regions.size();
+			return stats;
+		}
+
+	private:
+		const ProgramImage& image;
+		const std::vector<uint32_t>& stream;
+		std::vector<Node> nodes;
+		size_t entry = 0;
+		Cfg cfg;
+		Stats stats;
+
+		//Blocks of every region in ascending order, and the region of every block
+		std::vector<std::vector<size_t>> regions;
+		std::vector<size_t> regionOf;
+
+		static constexpr size_t NoRegion = static_cast<size_t>(-1);
+
+		static std::string _hex(uint64_t value) {
+			std::ostringstream out;
+			out << "0x" << std::hex << std::uppercase << value;
+			return out.str();
+		}
+
+		static std::string _reg(uint32_t id) {
+			return "f.r[" + std::to_string(id) + "]";
+		}
+
+		//Jumps translated into C++, the conditional and unconditional direct and relative jumps
+		static bool _isInlineJump(Mnemonic m) {
+			auto flow = flowOf(m);
+			return (flow == Flow::Jump || flow == Flow::Branch) && (cmn::isDirectJump(m) || cmn::isRelativeJump(m));
+		}
+
+		static std::string _name(Mnemonic m) {
+			static const char* jumps[] = {
+				"Jmp", "Jb", "Jnb", "Jbe", "Jnbe", "Jl", "Jnl", "Jle", "Jnle", "Jz", "Jnz", "Je", "Jne",
+			};
+
+			if (_isInlineJump(m)) {
+				bool relative = cmn::isRelativeJump(m);
+				auto first = relative ? Mnemonic::RJmp_A : Mnemonic::Jmp_A;
+				auto index = (static_cast<uint32_t>(m) - static_cast<uint32_t>(first)) / 3;
+				return std::string{ "Mnemonic::" } + (relative ? "R" : "") + jumps[index] + "_A";
+			}
+
+			switch (m) {
+				case Mnemonic::Nop:			return "Mnemonic::Nop";
+				case Mnemonic::Mov_R_R:		return "Mnemonic::Mov_R_R";
+				case Mnemonic::Mov_R_V:		return "Mnemonic::Mov_R_V";
+				case Mnemonic::Inc_R:		return "Mnemonic::Inc_R";
+				case Mnemonic::Dec_R:		return "Mnemonic::Dec_R";
+				case Mnemonic::Add_R_R:		return "Mnemonic::Add_R_R";
+				case Mnemonic::Add_R_V:		return "Mnemonic::Add_R_V";
+				case Mnemonic::Sub_R_R:		return "Mnemonic::Sub_R_R";
+				case Mnemonic::Sub_R_V:		return "Mnemonic::Sub_R_V";
+				case Mnemonic::Mul_R_R:		return "Mnemonic::Mul_R_R";
+				case Mnemonic::Mul_R_V:		return "Mnemonic::Mul_R_V";
+				case Mnemonic::Lsh_R_V:		return "Mnemonic::Lsh_R_V";
+				case Mnemonic::Rsh_R_V:		return "Mnemonic::Rsh_R_V";
+				case Mnemonic::And_R_R:		return "Mnemonic::And_R_R";
+				case Mnemonic::And_R_V:		return "Mnemonic::And_R_V";
+				case Mnemonic::Or_R_R:		return "Mnemonic::Or_R_R";
+				case Mnemonic::Or_R_V:		return "Mnemonic::Or_R_V";
+				case Mnemonic::Xor_R_R:		return "Mnemonic::Xor_R_R";
+				case Mnemonic::Xor_R_V:		return "Mnemonic::Xor_R_V";
+				case Mnemonic::Test_R_R:	return "Mnemonic::Test_R_R";
+				case Mnemonic::Test_R_V:	return "Mnemonic::Test_R_V";
+				default:
+					return "static_cast<Mnemonic>(" + std::to_string(static_cast<uint32_t>(m)) + ")";
+			}
+		}
+
+		//C++ statement of an instruction that never fails and never transfers control,
+		//returns false if the instruction is not one of them.
+		//instrPtr is neither read nor written, it is only updated when entering the instructions
+		static bool _translate(const Instruction& instr, std::string& into) {
+			auto isPlain = [](uint32_t id) {
+				return id < RegisterCount && id != InstrPtrId;
+			};
+
+			auto a = instr.arg1;
+			auto b = instr.arg2;
+			const char* op = nullptr;
+			bool byValue = false;
+
+			switch (instr.mnemonic) {
+				case Mnemonic::Nop:
+					into.clear();
+					return true;
+				case Mnemonic::Inc_R:
+				case Mnemonic::Dec_R:
+					if (!isPlain(a))
+						return false;
+					into = (instr.mnemonic == Mnemonic::Inc_R ? "++" : "--") + _reg(a) + ";";
+					return true;
+				case Mnemonic::Test_R_R:
+				case Mnemonic::Test_R_V:
+					if (!isPlain(a) || (instr.mnemonic == Mnemonic::Test_R_R && !isPlain(b)))
+						return false;
+					into = "f.test(" + _reg(a) + ", "
+						+ (instr.mnemonic == Mnemonic::Test_R_R ? _reg(b) : _hex(b) + "u") + ");";
+					return true;
+				case Mnemonic::Lsh_R_V:
+				case Mnemonic::Rsh_R_V:
+					//The VM shifts by the value as it is, which C++ leaves undefined from 32 on
+					if (b >= 32)
+						return false;
+					op = instr.mnemonic == Mnemonic::Lsh_R_V ? "<<=" : ">>=";
+					byValue = true;
+					break;
+				case Mnemonic::Mov_R_R:	op = "=";	break;
+				case Mnemonic::Add_R_R:	op = "+=";	break;
+				case Mnemonic::Sub_R_R:	op = "-=";	break;
+				case Mnemonic::Mul_R_R:	op = "*=";	break;
+				case Mnemonic::And_R_R:	op = "&=";	break;
+				case Mnemonic::Or_R_R:	op = "|=";	break;
+				case Mnemonic::Xor_R_R:	op = "^=";	break;
+				case Mnemonic::Mov_R_V:	op = "=";	byValue = true;	break;
+				case Mnemonic::Add_R_V:	op = "+=";	byValue = true;	break;
+				case Mnemonic::Sub_R_V:	op = "-=";	byValue = true;	break;
+				case Mnemonic::Mul_R_V:	op = "*=";	byValue = true;	break;
+				case Mnemonic::And_R_V:	op = "&=";	byValue = true;	break;
+				case Mnemonic::Or_R_V:	op = "|=";	byValue = true;	break;
+				case Mnemonic::Xor_R_V:	op = "^=";	byValue = true;	break;
+				default:
+					return false;
+			}
+
+			if (!isPlain(a) || (!byValue && !isPlain(b)))
+				return false;
+
+			into = _reg(a) + " " + op + " " + (byValue ? _hex(b) + "u" : _reg(b)) + ";";
+			return true;
+		}
+
+		bool _isInlined(size_t index) const {
+			std::string ignored;
+			return _translate(nodes[index].instr, ignored) || _isInlineJump(nodes[index].instr.mnemonic);
+		}
+
+		//Successors of a block within the function it belongs to, calls are left out
+		std::vector<size_t> _successors(size_t b) const {
+			std::vector<size_t> successors;
+			auto& block = cfg.blocks[b];
+			auto& last = nodes[block.last];
+			auto flow = last.flow();
+
+			if ((flow == Flow::Jump || flow == Flow::Branch) && last.hasTarget() && last.target < nodes.size())
+				successors.push_back(cfg.blockOf[last.target]);
+			if (flow != Flow::Jump && flow != Flow::Stop && b + 1 < cfg.blocks.size())
+				successors.push_back(b + 1);
+			return successors;
+		}
+
+		void _formRegions() {
+			regions.clear();
+			regionOf.assign(cfg.blocks.size(), NoRegion);
+
+			std::vector<size_t> seeds;
+			if (entry < nodes.size())
+				seeds.push_back(cfg.blockOf[entry]);
+			for (auto& node : nodes) {
+				if (node.flow() == Flow::Call && node.hasTarget() && node.target < nodes.size())
+					seeds.push_back(cfg.blockOf[node.target]);
+			}
+			for (size_t b = 0; b < cfg.blocks.size(); ++b)
+				seeds.push_back(b);
+
+			for (auto seed : seeds) {
+				if (regionOf[seed] != NoRegion)
+					continue;
+
+				auto region = regions.size();
+				regions.emplace_back();
+				std::vector<size_t> pending = { seed };
+				while (!pending.empty()) {
+					auto b = pending.back();
+					pending.pop_back();
+					if (regionOf[b] != NoRegion)
+						continue;
+
+					regionOf[b] = region;
+					regions[region].push_back(b);
+					for (auto succ : _successors(b))
+						pending.push_back(succ);
+				}
+
+				std::sort(regions[region].begin(), regions[region].end());
+			}
+		}
+
+		//Continues at the instruction with the given index, within the region if it is one of its blocks
+		void _emitTransfer(std::ostream& out, size_t region, size_t target, uint32_t address, const char* indent) {
+			if (target < nodes.size() && cfg.isLeader(target) && regionOf[cfg.blockOf[target]] == region) {
+				out << indent << "if (!f.enter(" << _hex(address) << "))\n"
+					<< indent << "\treturn f.proceed;\n"
+					<< indent << "goto L_" << target << ";\n";
+			}
+			else {
+				out << indent << "return f.jump(" << _hex(address) << ");\n";
+			}
+		}
+
+		void _emitRegion(std::ostream& out, size_t region) {
+			auto& blocks = regions[region];
+
+			//Runs of inlined instructions entered at once, the first instruction
+			//of every block is entered on its own when control reaches the block
+			std::vector<std::pair<size_t, size_t>> runs;
+			bool leaves = false;
+			for (auto b : blocks) {
+				auto& block = cfg.blocks[b];
+				for (auto i = block.first; i <= block.last; ++i)
+					leaves |= !_isInlined(i);
+				for (auto i = block.first + 1; i <= block.last;) {
+					auto end = i;
+					while (end <= block.last && _isInlined(end))
+						++end;
+					if (end - i >= 2)
+						runs.push_back({ i, end });
+					i = std::max(end, i + 1);
+				}
+			}
+
+			out << "\n";
+			for (auto& run : runs) {
+				out << "\tconstexpr Mnemonic run_" << run.first << "[] = {";
+				for (auto i = run.first; i < run.second; ++i)
+					out << (i == run.first ? " " : ", ") << _name(nodes[i].instr.mnemonic);
+				out << " };\n";
+			}
+			if (!runs.empty())
+				out << "\n";
+
+			out << "\tbool region" << region << "(AotFrame& f) {\n";
+			if (leaves)
+				out << "\tentry:\n";
+			out << "\t\tswitch (f.start()) {\n";
+			for (auto b : blocks) {
+				auto first = cfg.blocks[b].first;
+				out << "\t\t\tcase " << _hex(image.addressOf(first)) << ":\tgoto L_" << first << ";\n";
+			}
+			out << "\t\t\tdefault:\treturn true;\n"
+				<< "\t\t}\n";
+
+			size_t nextRun = 0;
+			for (auto b : blocks) {
+				auto& block = cfg.blocks[b];
+				out << "\n\tL_" << block.first << ":\n";
+				++stats.entryPoints;
+
+				for (auto i = block.first; i <= block.last; ++i) {
+					auto address = image.addressOf(i);
+					auto& node = nodes[i];
+
+					while (nextRun < runs.size() && runs[nextRun].second <= i)
+						++nextRun;
+					if (nextRun < runs.size() && runs[nextRun].first <= i && i < runs[nextRun].second) {
+						if (runs[nextRun].first == i)
+							out << "\t\tif (!f.enterRun(" << _hex(address) << ", run_" << i << "))\n"
+								<< "\t\t\treturn f.proceed;\n";
+					}
+					else if (i != block.first) {
+						out << "\t\tif (!f.enter(" << _hex(address) << "))\n"
+							<< "\t\t\treturn f.proceed;\n";
+					}
+
+					std::string statement;
+					if (_translate(node.instr, statement)) {
+						if (!statement.empty())
+							out << "\t\t" << statement << "\n";
+						++stats.inlined;
+					}
+					else if (_isInlineJump(node.instr.mnemonic)) {
+						uint32_t target = node.hasTarget() ? image.addressOf(node.target) : node.outside;
+						if (node.flow() == Flow::Jump) {
+							_emitTransfer(out, region, node.target, target, "\t\t");
+						}
+						else {
+							out << "\t\tif (f.taken(" << _name(node.instr.mnemonic) << ")) {\n";
+							_emitTransfer(out, region, node.target, target, "\t\t\t");
+							out << "\t\t}\n";
+						}
+						++stats.inlined;
+					}
+					else {
+						out << "\t\tif (!f.perform(" << _hex(address + 3) << "))\n"
+							<< "\t\t\tgoto leave;\n";
+						++stats.performed;
+					}
+				}
+
+				//Falls through into the following instruction
+				if (nodes[block.last].flow() != Flow::Jump || !_isInlineJump(nodes[block.last].instr.mnemonic))
+					_emitTransfer(out, region, block.last + 1, image.addressOf(block.last + 1), "\t\t");
+			}
+
+			//The instruction run by the VM continued somewhere else than with the following instruction
+			if (leaves) {
+				out << "\n\tleave:\n"
+					<< "\t\tif (!f.resume())\n"
+					<< "\t\t\treturn f.proceed;\n"
+					<< "\t\tswitch (f.next()) {\n";
+				for (auto b : blocks)
+					out << "\t\t\tcase " << _hex(image.addressOf(cfg.blocks[b].first)) << ":\n";
+				out << "\t\t\t\tbreak;\n"
+					<< "\t\t\tdefault:\n"
+					<< "\t\t\t\treturn true;\n"
+					<< "\t\t}\n"
+					<< "\t\tif (!f.enter(f.next()))\n"
+					<< "\t\t\treturn f.proceed;\n"
+					<< "\t\tgoto entry;\n";
+			}
+
+			out << "\t}\n";
+		}
+
+		void _emitModule(std::ostream& out) {
+			std::vector<std::pair<uint32_t, size_t>> entryPoints;
+			for (size_t r = 0; r < regions.size(); ++r) {
+				for (auto b : regions[r])
+					entryPoints.push_back({ image.addressOf(cfg.blocks[b].first), r });
+			}
+			std::sort(entryPoints.begin(), entryPoints.end());
+
+			if (!entryPoints.empty()) {
+				out << "\n\tconst sbl::vm::AotRegion regions[] = {\n";
+				for (auto& [address, region] : entryPoints)
+					out << "\t\t{ " << _hex(address) << ", &region" << region << " },\n";
+				out << "\t};\n";
+			}
+			out << "\n";
+
+			out << "\tconst sbl::vm::AotModule module = {\n"
+				<< "\t\t" << _hex(vm::aotImageHash(stream)) << "ull,\n"
+				<< "\t\t" << stream.size() << ",\n"
+				<< "\t\t" << (entryPoints.empty() ? "nullptr" : "regions") << ",\n"
+				<< "\t\t" << entryPoints.size() << ",\n"
+				<< "\t};\n\n"
+				<< "\tconst bool registered = sbl::vm::registerAotModule(module);\n";
+		}
+	};
+}
+
+#endif	//AOT_TRANSPILER_HEADER_H_
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+
+#include "Transpiler.hpp"
+
+/*
+	sbl-aot, compiles a program image to C++
+
+	Usage:
+		sbl-aot <image> <output.cpp>
+
+	The output has to be compiled together with the interpreter built with SBL_AOT
+	(see interpreter/Config.hpp), with src as one of its include directories.
+	It registers itself from a static initializer, so it must be linked as an object file,
+	a static library would drop it. The VM then runs the compiled code whenever it loads
+	exactly the same image, any other image keeps running in the interpreter.
+*/
+
+namespace {
+	bool readImage(const std::string& filename, std::vector<uint32_t>& words) {
+		namespace fs = std::filesystem;
+
+		std::error_code fe;
+		auto fsize = fs::file_size(fs::path{ filename }, fe);
+		if (fe || fsize < sizeof(sbl::vm::CompiledHeader))
+			return false;
+
+		std::ifstream file{ filename, std::ios_base::binary };
+		if (!file)
+			return false;
+
+		words.resize(fsize / 4);
+		file.read(reinterpret_cast<char*>(&words[0]), fsize);
+		return static_cast<bool>(file);
+	}
+}
+
+int main(int argc, char** argv) {
+	using namespace sbl::aot;
+
+	if (argc != 3) {
+		std::cerr << "Usage: sbl-aot <image> <output.cpp>\n";
+		return 2;
+	}
+
+	std::vector<uint32_t> words;
+	if (!readImage(argv[1], words)) {
+		std::cerr << "sbl-aot: cannot read " << argv[1] << "\n";
+		return 1;
+	}
+
+	ProgramImage image;
+	if (!image.load(words)) {
+		std::cerr << "sbl-aot: " << argv[1] << " is not a valid program image\n";
+		return 1;
+	}
+
+	std::ofstream output{ argv[2] };
+	if (!output) {
+		std::cerr << "sbl-aot: cannot write " << argv[2] << "\n";
+		return 1;
+	}
+
+	Transpiler transpiler{ image, words };
+	auto stats = transpiler.run(output);
+
+	if (!output) {
+		std::cerr << "sbl-aot: cannot write " << argv[2] << "\n";
+		return 1;
+	}
+
+	std::cout << "regions:      " << stats.regions << " (" << stats.entryPoints << " entry points)\n"
+			  << "instructions: " << stats.inlined + stats.performed << "\n"
+			  << "  translated: " << stats.inlined << "\n"
+			  << "  runners:    " << stats.performed << "\n";
+
+	return 0;
+}
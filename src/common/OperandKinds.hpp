@@ -0,0 +1,944 @@
+#pragma once
+
+#ifndef COMMON_OPERAND_KINDS_HEADER_H_
+#define COMMON_OPERAND_KINDS_HEADER_H_
+
+#include <cstdint>
+
+#include "Instruction.hpp"
+
+namespace sbl::cmn {
+	/*
+		Kind of every operand of an instruction, as encoded by the suffix
+		of its mnemonic(_R, _A, _I, _V).
+
+		Floating point instructions(Fp*) address the floating point registers
+		and immediates with their _R and _V operands, every other instruction
+		addresses the integer ones.
+	*/
+	enum class OperandKind : uint8_t {
+		None,
+		Register,
+		Address,
+		Indirect,
+		Value,
+		FpRegister,
+		FpValue,
+	};
+
+	struct OperandKinds {
+		OperandKind first;
+		OperandKind second;
+	};
+
+	constexpr OperandKinds operandKinds(Mnemonic m) {
+		switch (m) {
+			case Mnemonic::Mov_R_R:
+			case Mnemonic::Move_R_R:
+			case Mnemonic::Movne_R_R:
+			case Mnemonic::Movz_R_R:
+			case Mnemonic::Movnz_R_R:
+			case Mnemonic::Vcall_R_R:
+			case Mnemonic::RVcall_R_R:
+			case Mnemonic::Xchg_R_R:
+			case Mnemonic::IsExtEnabled_R_R:
+			case Mnemonic::SetSegmntAccs_R_R:
+			case Mnemonic::GetSegmntAccs_R_R:
+			case Mnemonic::Add_R_R:
+			case Mnemonic::Sub_R_R:
+			case Mnemonic::Mul_R_R:
+			case Mnemonic::Div_R_R:
+			case Mnemonic::Mod_R_R:
+			case Mnemonic::Lsh_R_R:
+			case Mnemonic::Rlsh_R_R:
+			case Mnemonic::Rsh_R_R:
+			case Mnemonic::Rrsh_R_R:
+			case Mnemonic::And_R_R:
+			case Mnemonic::Or_R_R:
+			case Mnemonic::Xor_R_R:
+			case Mnemonic::Eq_R_R:
+			case Mnemonic::Neq_R_R:
+			case Mnemonic::Lt_R_R:
+			case Mnemonic::Bt_R_R:
+			case Mnemonic::Test_R_R:
+			case Mnemonic::Alloc_R_R:
+			case Mnemonic::LoadDyn_R_R:
+			case Mnemonic::WriteDyn_R_R:
+			case Mnemonic::GetDynSize_R_R:
+			case Mnemonic::RegInt_R_R:
+			case Mnemonic::RRegInt_R_R:
+			case Mnemonic::SetInstrPrivlg_R_R:
+			case Mnemonic::GetInstrPrivlg_R_R:
+			case Mnemonic::SetIntPrivlg_R_R:
+			case Mnemonic::GetIntPrivlg_R_R:
+			case Mnemonic::SetIntExecPrivlg_R_R:
+			case Mnemonic::GetIntExecPrivlg_R_R:
+			case Mnemonic::SetExtPrivlg_R_R:
+			case Mnemonic::GetExtPrivlg_R_R:
+			case Mnemonic::PCall_R_R:
+			case Mnemonic::RPCall_R_R:
+			case Mnemonic::PNtvCall_R_R:
+				return { OperandKind::Register, OperandKind::Register };
+
+			case Mnemonic::Mov_R_A:
+			case Mnemonic::Move_R_A:
+			case Mnemonic::Movne_R_A:
+			case Mnemonic::Movz_R_A:
+			case Mnemonic::Movnz_R_A:
+			case Mnemonic::Laddr_R_A:
+			case Mnemonic::Loadload_R_A:
+			case Mnemonic::Vcall_R_A:
+			case Mnemonic::RVcall_R_A:
+			case Mnemonic::GetNtvId_R_A:
+			case Mnemonic::Xchg_R_A:
+			case Mnemonic::IsExtEnabled_R_A:
+			case Mnemonic::SetSegmntAccs_R_A:
+			case Mnemonic::GetSegmntAccs_R_A:
+			case Mnemonic::Add_R_A:
+			case Mnemonic::Sub_R_A:
+			case Mnemonic::Mul_R_A:
+			case Mnemonic::Div_R_A:
+			case Mnemonic::Mod_R_A:
+			case Mnemonic::Lsh_R_A:
+			case Mnemonic::Rlsh_R_A:
+			case Mnemonic::Rsh_R_A:
+			case Mnemonic::Rrsh_R_A:
+			case Mnemonic::And_R_A:
+			case Mnemonic::Or_R_A:
+			case Mnemonic::Xor_R_A:
+			case Mnemonic::Eq_R_A:
+			case Mnemonic::Neq_R_A:
+			case Mnemonic::Lt_R_A:
+			case Mnemonic::Bt_R_A:
+			case Mnemonic::Test_R_A:
+			case Mnemonic::Alloc_R_A:
+			case Mnemonic::LoadDyn_R_A:
+			case Mnemonic::WriteDyn_R_A:
+			case Mnemonic::GetDynSize_R_A:
+			case Mnemonic::Regint_R_A:
+			case Mnemonic::RRegInt_R_A:
+			case Mnemonic::SetInstrPrivlg_R_A:
+			case Mnemonic::GetInstrPrivlg_R_A:
+			case Mnemonic::SetIntPrivlg_R_A:
+			case Mnemonic::GetIntPrivlg_R_A:
+			case Mnemonic::SetIntExecPrivlg_R_A:
+			case Mnemonic::GetIntExecPrivlg_R_A:
+			case Mnemonic::SetExtPrivlg_R_A:
+			case Mnemonic::GetExtPrivlg_R_A:
+			case Mnemonic::PCall_R_A:
+			case Mnemonic::RPCall_R_A:
+			case Mnemonic::PNtvCall_R_A:
+				return { OperandKind::Register, OperandKind::Address };
+
+			case Mnemonic::Mov_R_I:
+			case Mnemonic::Move_R_I:
+			case Mnemonic::Movne_R_I:
+			case Mnemonic::Movz_R_I:
+			case Mnemonic::Movnz_R_I:
+			case Mnemonic::Laddr_R_I:
+			case Mnemonic::Loadload_R_I:
+			case Mnemonic::Vcall_R_I:
+			case Mnemonic::RVcall_R_I:
+			case Mnemonic::GetNtvId_R_I:
+			case Mnemonic::Xchg_R_I:
+			case Mnemonic::IsExtEnabled_R_I:
+			case Mnemonic::SetSegmntAccs_R_I:
+			case Mnemonic::GetSegmntAccs_R_I:
+			case Mnemonic::Add_R_I:
+			case Mnemonic::Sub_R_I:
+			case Mnemonic::Mul_R_I:
+			case Mnemonic::Div_R_I:
+			case Mnemonic::Mod_R_I:
+			case Mnemonic::Lsh_R_I:
+			case Mnemonic::Rlsh_R_I:
+			case Mnemonic::Rsh_R_I:
+			case Mnemonic::Rrsh_R_I:
+			case Mnemonic::And_R_I:
+			case Mnemonic::Or_R_I:
+			case Mnemonic::Xor_R_I:
+			case Mnemonic::Eq_R_I:
+			case Mnemonic::Neq_R_I:
+			case Mnemonic::Lt_R_I:
+			case Mnemonic::Bt_R_I:
+			case Mnemonic::Test_R_I:
+			case Mnemonic::Alloc_R_I:
+			case Mnemonic::LoadDyn_R_I:
+			case Mnemonic::WriteDyn_R_I:
+			case Mnemonic::GetDynSize_R_I:
+			case Mnemonic::Regint_R_I:
+			case Mnemonic::RRegInt_R_I:
+			case Mnemonic::SetInstrPrivlg_R_I:
+			case Mnemonic::GetInstrPrivlg_R_I:
+			case Mnemonic::SetIntPrivlg_R_I:
+			case Mnemonic::GetIntPrivlg_R_I:
+			case Mnemonic::SetIntExecPrivlg_R_I:
+			case Mnemonic::GetIntExecPrivlg_R_I:
+			case Mnemonic::SetExtPrivlg_R_I:
+			case Mnemonic::GetExtPrivlg_R_I:
+			case Mnemonic::PCall_R_I:
+			case Mnemonic::RPCall_R_I:
+			case Mnemonic::PNtvCall_R_I:
+				return { OperandKind::Register, OperandKind::Indirect };
+
+			case Mnemonic::Mov_R_V:
+			case Mnemonic::Move_R_V:
+			case Mnemonic::Movne_R_V:
+			case Mnemonic::Movz_R_V:
+			case Mnemonic::Movnz_R_V:
+			case Mnemonic::Vcall_R_V:
+			case Mnemonic::RVcall_R_V:
+			case Mnemonic::IsExtEnabled_R_V:
+			case Mnemonic::SetSegmntAccs_R_V:
+			case Mnemonic::GetSegmntAccs_R_V:
+			case Mnemonic::Add_R_V:
+			case Mnemonic::Sub_R_V:
+			case Mnemonic::Mul_R_V:
+			case Mnemonic::Div_R_V:
+			case Mnemonic::Mod_R_V:
+			case Mnemonic::Lsh_R_V:
+			case Mnemonic::Rlsh_R_V:
+			case Mnemonic::Rsh_R_V:
+			case Mnemonic::Rrsh_R_V:
+			case Mnemonic::And_R_V:
+			case Mnemonic::Or_R_V:
+			case Mnemonic::Xor_R_V:
+			case Mnemonic::Eq_R_V:
+			case Mnemonic::Neq_R_V:
+			case Mnemonic::Lt_R_V:
+			case Mnemonic::Bt_R_V:
+			case Mnemonic::Test_R_V:
+			case Mnemonic::Alloc_R_V:
+			case Mnemonic::LoadDyn_R_V:
+			case Mnemonic::WriteDyn_R_V:
+			case Mnemonic::GetDynSize_R_V:
+			case Mnemonic::SetInstrPrivlg_R_V:
+			case Mnemonic::GetInstrPrivlg_R_V:
+			case Mnemonic::SetIntPrivlg_R_V:
+			case Mnemonic::GetIntPrivlg_R_V:
+			case Mnemonic::SetIntExecPrivlg_R_V:
+			case Mnemonic::GetIntExecPrivlg_R_V:
+			case Mnemonic::SetExtPrivlg_R_V:
+			case Mnemonic::GetExtPrivlg_R_V:
+			case Mnemonic::PCall_R_V:
+			case Mnemonic::RPCall_R_V:
+			case Mnemonic::PNtvCall_R_V:
+				return { OperandKind::Register, OperandKind::Value };
+
+			case Mnemonic::Push_R:
+			case Mnemonic::Pop_R:
+			case Mnemonic::Inc_R:
+			case Mnemonic::Dec_R:
+			case Mnemonic::Call_R:
+			case Mnemonic::RCall_R:
+			case Mnemonic::Read_R:
+			case Mnemonic::Print_R:
+			case Mnemonic::PrintS_R:
+			case Mnemonic::PrintC_R:
+			case Mnemonic::Jmp_R:
+			case Mnemonic::Jb_R:
+			case Mnemonic::Jnb_R:
+			case Mnemonic::Jbe_R:
+			case Mnemonic::Jnbe_R:
+			case Mnemonic::Jl_R:
+			case Mnemonic::Jnl_R:
+			case Mnemonic::Jle_R:
+			case Mnemonic::Jnle_R:
+			case Mnemonic::Jz_R:
+			case Mnemonic::Jnz_R:
+			case Mnemonic::Je_R:
+			case Mnemonic::Jne_R:
+			case Mnemonic::RJmp_R:
+			case Mnemonic::RJb_R:
+			case Mnemonic::RJnb_R:
+			case Mnemonic::RJbe_R:
+			case Mnemonic::RJnbe_R:
+			case Mnemonic::RJl_R:
+			case Mnemonic::RJnl_R:
+			case Mnemonic::RJle_R:
+			case Mnemonic::RJnle_R:
+			case Mnemonic::RJz_R:
+			case Mnemonic::RJnz_R:
+			case Mnemonic::RJe_R:
+			case Mnemonic::RJne_R:
+			case Mnemonic::Time_R:
+			case Mnemonic::Time64_R:
+			case Mnemonic::ICount_R:
+			case Mnemonic::ICount64_R:
+			case Mnemonic::NtvCall_R:
+			case Mnemonic::EnableExt_R:
+			case Mnemonic::DisableExt_R:
+			case Mnemonic::Not_R:
+			case Mnemonic::Dealloc_R:
+			case Mnemonic::DynOffset_R:
+			case Mnemonic::Raise_R:
+			case Mnemonic::DisableInt_R:
+			case Mnemonic::EnableInt_R:
+			case Mnemonic::ICountInt_R:
+			case Mnemonic::RICountInt_R:
+			case Mnemonic::ICountInt64_R:
+			case Mnemonic::RICountInt64_R:
+			case Mnemonic::GetPrivlg_R:
+			case Mnemonic::SetPrivlg_R:
+			case Mnemonic::MvSignFlag_R:
+			case Mnemonic::MvInfFlag_R:
+			case Mnemonic::MvNanFlag_R:
+				return { OperandKind::Register, OperandKind::None };
+
+			case Mnemonic::Mov_A_R:
+			case Mnemonic::Move_A_R:
+			case Mnemonic::Movne_A_R:
+			case Mnemonic::Movz_A_R:
+			case Mnemonic::Movnz_A_R:
+			case Mnemonic::Vcall_A_R:
+			case Mnemonic::RVcall_A_R:
+			case Mnemonic::Xchg_A_R:
+			case Mnemonic::IsExtEnabled_A_R:
+			case Mnemonic::SetSegmntAccs_A_R:
+			case Mnemonic::GetSegmntAccs_A_R:
+			case Mnemonic::Add_A_R:
+			case Mnemonic::Sub_A_R:
+			case Mnemonic::Mul_A_R:
+			case Mnemonic::Div_A_R:
+			case Mnemonic::Mod_A_R:
+			case Mnemonic::Lsh_A_R:
+			case Mnemonic::Rlsh_A_R:
+			case Mnemonic::Rsh_A_R:
+			case Mnemonic::Rrsh_A_R:
+			case Mnemonic::And_A_R:
+			case Mnemonic::Or_A_R:
+			case Mnemonic::Xor_A_R:
+			case Mnemonic::Eq_A_R:
+			case Mnemonic::Neq_A_R:
+			case Mnemonic::Lt_A_R:
+			case Mnemonic::Bt_A_R:
+			case Mnemonic::Test_A_R:
+			case Mnemonic::Alloc_A_R:
+			case Mnemonic::LoadDyn_A_R:
+			case Mnemonic::WriteDyn_A_R:
+			case Mnemonic::GetDynSize_A_R:
+			case Mnemonic::RegInt_A_R:
+			case Mnemonic::RRegInt_A_R:
+			case Mnemonic::SetInstrPrivlg_A_R:
+			case Mnemonic::GetInstrPrivlg_A_R:
+			case Mnemonic::SetIntPrivlg_A_R:
+			case Mnemonic::GetIntPrivlg_A_R:
+			case Mnemonic::SetIntExecPrivlg_A_R:
+			case Mnemonic::GetIntExecPrivlg_A_R:
+			case Mnemonic::SetExtPrivlg_A_R:
+			case Mnemonic::GetExtPrivlg_A_R:
+			case Mnemonic::PCall_A_R:
+			case Mnemonic::RPCall_A_R:
+			case Mnemonic::PNtvCall_A_R:
+				return { OperandKind::Address, OperandKind::Register };
+
+			case Mnemonic::Mov_A_A:
+			case Mnemonic::Move_A_A:
+			case Mnemonic::Movne_A_A:
+			case Mnemonic::Movz_A_A:
+			case Mnemonic::Movnz_A_A:
+			case Mnemonic::Laddr_A_A:
+			case Mnemonic::Loadload_A_A:
+			case Mnemonic::Vcall_A_A:
+			case Mnemonic::RVcall_A_A:
+			case Mnemonic::GetNtvId_A_A:
+			case Mnemonic::Xchg_A_A:
+			case Mnemonic::Hotpatch_A_A:
+			case Mnemonic::RHotpatch_A_A:
+			case Mnemonic::IsExtEnabled_A_A:
+			case Mnemonic::SetSegmntAccs_A_A:
+			case Mnemonic::GetSegmntAccs_A_A:
+			case Mnemonic::Add_A_A:
+			case Mnemonic::Sub_A_A:
+			case Mnemonic::Mul_A_A:
+			case Mnemonic::Div_A_A:
+			case Mnemonic::Mod_A_A:
+			case Mnemonic::Lsh_A_A:
+			case Mnemonic::Rlsh_A_A:
+			case Mnemonic::Rsh_A_A:
+			case Mnemonic::Rrsh_A_A:
+			case Mnemonic::And_A_A:
+			case Mnemonic::Or_A_A:
+			case Mnemonic::Xor_A_A:
+			case Mnemonic::Eq_A_A:
+			case Mnemonic::Neq_A_A:
+			case Mnemonic::Lt_A_A:
+			case Mnemonic::Bt_A_A:
+			case Mnemonic::Test_A_A:
+			case Mnemonic::Alloc_A_A:
+			case Mnemonic::LoadDyn_A_A:
+			case Mnemonic::WriteDyn_A_A:
+			case Mnemonic::GetDynSize_A_A:
+			case Mnemonic::Regint_A_A:
+			case Mnemonic::RRegInt_A_A:
+			case Mnemonic::SetInstrPrivlg_A_A:
+			case Mnemonic::GetInstrPrivlg_A_A:
+			case Mnemonic::SetIntPrivlg_A_A:
+			case Mnemonic::GetIntPrivlg_A_A:
+			case Mnemonic::SetIntExecPrivlg_A_A:
+			case Mnemonic::GetIntExecPrivlg_A_A:
+			case Mnemonic::SetExtPrivlg_A_A:
+			case Mnemonic::GetExtPrivlg_A_A:
+			case Mnemonic::PCall_A_A:
+			case Mnemonic::RPCall_A_A:
+			case Mnemonic::PNtvCall_A_A:
+				return { OperandKind::Address, OperandKind::Address };
+
+			case Mnemonic::Mov_A_I:
+			case Mnemonic::Move_A_I:
+			case Mnemonic::Movne_A_I:
+			case Mnemonic::Movz_A_I:
+			case Mnemonic::Movnz_A_I:
+			case Mnemonic::Laddr_A_I:
+			case Mnemonic::Loadload_A_I:
+			case Mnemonic::Vcall_A_I:
+			case Mnemonic::RVcall_A_I:
+			case Mnemonic::GetNtvId_A_I:
+			case Mnemonic::Xchg_A_I:
+			case Mnemonic::Hotpatch_A_I:
+			case Mnemonic::RHotpatch_A_I:
+			case Mnemonic::IsExtEnabled_A_I:
+			case Mnemonic::SetSegmntAccs_A_I:
+			case Mnemonic::GetSegmntAccs_A_I:
+			case Mnemonic::Add_A_I:
+			case Mnemonic::Sub_A_I:
+			case Mnemonic::Mul_A_I:
+			case Mnemonic::Div_A_I:
+			case Mnemonic::Mod_A_I:
+			case Mnemonic::Lsh_A_I:
+			case Mnemonic::Rlsh_A_I:
+			case Mnemonic::Rsh_A_I:
+			case Mnemonic::Rrsh_A_I:
+			case Mnemonic::And_A_I:
+			case Mnemonic::Or_A_I:
+			case Mnemonic::Xor_A_I:
+			case Mnemonic::Eq_A_I:
+			case Mnemonic::Neq_A_I:
+			case Mnemonic::Lt_A_I:
+			case Mnemonic::Bt_A_I:
+			case Mnemonic::Test_A_I:
+			case Mnemonic::Alloc_A_I:
+			case Mnemonic::LoadDyn_A_I:
+			case Mnemonic::WriteDyn_A_I:
+			case Mnemonic::GetDynSize_A_I:
+			case Mnemonic::Regint_A_I:
+			case Mnemonic::RRegInt_A_I:
+			case Mnemonic::SetInstrPrivlg_A_I:
+			case Mnemonic::GetInstrPrivlg_A_I:
+			case Mnemonic::SetIntPrivlg_A_I:
+			case Mnemonic::GetIntPrivlg_A_I:
+			case Mnemonic::SetIntExecPrivlg_A_I:
+			case Mnemonic::GetIntExecPrivlg_A_I:
+			case Mnemonic::SetExtPrivlg_A_I:
+			case Mnemonic::GetExtPrivlg_A_I:
+			case Mnemonic::PCall_A_I:
+			case Mnemonic::RPCall_A_I:
+			case Mnemonic::PNtvCall_A_I:
+				return { OperandKind::Address, OperandKind::Indirect };
+
+			case Mnemonic::Mov_A_V:
+			case Mnemonic::Move_A_V:
+			case Mnemonic::Movne_A_V:
+			case Mnemonic::Movz_A_V:
+			case Mnemonic::Movnz_A_V:
+			case Mnemonic::Vcall_A_V:
+			case Mnemonic::RVcall_A_V:
+			case Mnemonic::IsExtEnabled_A_V:
+			case Mnemonic::SetSegmntAccs_A_V:
+			case Mnemonic::GetSegmntAccs_A_V:
+			case Mnemonic::Add_A_V:
+			case Mnemonic::Sub_A_V:
+			case Mnemonic::Mul_A_V:
+			case Mnemonic::Div_A_V:
+			case Mnemonic::Mod_A_V:
+			case Mnemonic::Lsh_A_V:
+			case Mnemonic::Rlsh_A_V:
+			case Mnemonic::Rsh_A_V:
+			case Mnemonic::Rrsh_A_V:
+			case Mnemonic::And_A_V:
+			case Mnemonic::Or_A_V:
+			case Mnemonic::Xor_A_V:
+			case Mnemonic::Eq_A_V:
+			case Mnemonic::Neq_A_V:
+			case Mnemonic::Lt_A_V:
+			case Mnemonic::Bt_A_V:
+			case Mnemonic::Test_A_V:
+			case Mnemonic::Alloc_A_V:
+			case Mnemonic::LoadDyn_A_V:
+			case Mnemonic::WriteDyn_A_V:
+			case Mnemonic::GetDynSize_A_V:
+			case Mnemonic::SetInstrPrivlg_A_V:
+			case Mnemonic::GetInstrPrivlg_A_V:
+			case Mnemonic::SetIntPrivlg_A_V:
+			case Mnemonic::GetIntPrivlg_A_V:
+			case Mnemonic::SetIntExecPrivlg_A_V:
+			case Mnemonic::GetIntExecPrivlg_A_V:
+			case Mnemonic::SetExtPrivlg_A_V:
+			case Mnemonic::GetExtPrivlg_A_V:
+			case Mnemonic::PCall_A_V:
+			case Mnemonic::RPCall_A_V:
+			case Mnemonic::PNtvCall_A_V:
+				return { OperandKind::Address, OperandKind::Value };
+
+			case Mnemonic::Push_A:
+			case Mnemonic::Pop_A:
+			case Mnemonic::Inc_A:
+			case Mnemonic::Dec_A:
+			case Mnemonic::Call_A:
+			case Mnemonic::RCall_A:
+			case Mnemonic::Read_A:
+			case Mnemonic::Readstr_A:
+			case Mnemonic::Print_A:
+			case Mnemonic::PrintS_A:
+			case Mnemonic::PrintC_A:
+			case Mnemonic::Printstr_A:
+			case Mnemonic::Jmp_A:
+			case Mnemonic::Jb_A:
+			case Mnemonic::Jnb_A:
+			case Mnemonic::Jbe_A:
+			case Mnemonic::Jnbe_A:
+			case Mnemonic::Jl_A:
+			case Mnemonic::Jnl_A:
+			case Mnemonic::Jle_A:
+			case Mnemonic::Jnle_A:
+			case Mnemonic::Jz_A:
+			case Mnemonic::Jnz_A:
+			case Mnemonic::Je_A:
+			case Mnemonic::Jne_A:
+			case Mnemonic::RJmp_A:
+			case Mnemonic::RJb_A:
+			case Mnemonic::RJnb_A:
+			case Mnemonic::RJbe_A:
+			case Mnemonic::RJnbe_A:
+			case Mnemonic::RJl_A:
+			case Mnemonic::RJnl_A:
+			case Mnemonic::RJle_A:
+			case Mnemonic::RJnle_A:
+			case Mnemonic::RJz_A:
+			case Mnemonic::RJnz_A:
+			case Mnemonic::RJe_A:
+			case Mnemonic::RJne_A:
+			case Mnemonic::Time_A:
+			case Mnemonic::Time64_A:
+			case Mnemonic::ICount_A:
+			case Mnemonic::ICount64_A:
+			case Mnemonic::ExecInstr_A:
+			case Mnemonic::NtvCall_A:
+			case Mnemonic::EnableExt_A:
+			case Mnemonic::DisableExt_A:
+			case Mnemonic::Not_A:
+			case Mnemonic::Dealloc_A:
+			case Mnemonic::DynOffset_A:
+			case Mnemonic::Raise_A:
+			case Mnemonic::ICountInt64_A:
+			case Mnemonic::RICountInt64_A:
+			case Mnemonic::GetPrivlg_A:
+			case Mnemonic::SetPrivlg_A:
+			case Mnemonic::MvSignFlag_A:
+			case Mnemonic::MvInfFlag_A:
+			case Mnemonic::MvNanFlag_A:
+				return { OperandKind::Address, OperandKind::None };
+
+			case Mnemonic::Mov_I_R:
+			case Mnemonic::Move_I_R:
+			case Mnemonic::Movne_I_R:
+			case Mnemonic::Movz_I_R:
+			case Mnemonic::Movnz_I_R:
+			case Mnemonic::Vcall_I_R:
+			case Mnemonic::RVcall_I_R:
+			case Mnemonic::Xchg_I_R:
+			case Mnemonic::IsExtEnabled_I_R:
+			case Mnemonic::SetSegmntAccs_I_R:
+			case Mnemonic::GetSegmntAccs_I_R:
+			case Mnemonic::Add_I_R:
+			case Mnemonic::Sub_I_R:
+			case Mnemonic::Mul_I_R:
+			case Mnemonic::Div_I_R:
+			case Mnemonic::Mod_I_R:
+			case Mnemonic::Lsh_I_R:
+			case Mnemonic::Rlsh_I_R:
+			case Mnemonic::Rsh_I_R:
+			case Mnemonic::Rrsh_I_R:
+			case Mnemonic::And_I_R:
+			case Mnemonic::Or_I_R:
+			case Mnemonic::Xor_I_R:
+			case Mnemonic::Eq_I_R:
+			case Mnemonic::Neq_I_R:
+			case Mnemonic::Lt_I_R:
+			case Mnemonic::Bt_I_R:
+			case Mnemonic::Test_I_R:
+			case Mnemonic::Alloc_I_R:
+			case Mnemonic::LoadDyn_I_R:
+			case Mnemonic::WriteDyn_I_R:
+			case Mnemonic::GetDynSize_I_R:
+			case Mnemonic::RegInt_I_R:
+			case Mnemonic::RRegInt_I_R:
+			case Mnemonic::SetInstrPrivlg_I_R:
+			case Mnemonic::GetInstrPrivlg_I_R:
+			case Mnemonic::SetIntPrivlg_I_R:
+			case Mnemonic::GetIntPrivlg_I_R:
+			case Mnemonic::SetIntExecPrivlg_I_R:
+			case Mnemonic::GetIntExecPrivlg_I_R:
+			case Mnemonic::SetExtPrivlg_I_R:
+			case Mnemonic::GetExtPrivlg_I_R:
+			case Mnemonic::PCall_I_R:
+			case Mnemonic::RPCall_I_R:
+			case Mnemonic::PNtvCall_I_R:
+				return { OperandKind::Indirect, OperandKind::Register };
+
+			case Mnemonic::Mov_I_A:
+			case Mnemonic::Move_I_A:
+			case Mnemonic::Movne_I_A:
+			case Mnemonic::Movz_I_A:
+			case Mnemonic::Movnz_I_A:
+			case Mnemonic::Laddr_I_A:
+			case Mnemonic::Loadload_I_A:
+			case Mnemonic::Vcall_I_A:
+			case Mnemonic::RVcall_I_A:
+			case Mnemonic::GetNtvId_I_A:
+			case Mnemonic::Xchg_I_A:
+			case Mnemonic::Hotpatch_I_A:
+			case Mnemonic::RHotpatch_I_A:
+			case Mnemonic::IsExtEnabled_I_A:
+			case Mnemonic::SetSegmntAccs_I_A:
+			case Mnemonic::GetSegmntAccs_I_A:
+			case Mnemonic::Add_I_A:
+			case Mnemonic::Sub_I_A:
+			case Mnemonic::Mul_I_A:
+			case Mnemonic::Div_I_A:
+			case Mnemonic::Mod_I_A:
+			case Mnemonic::Lsh_I_A:
+			case Mnemonic::Rlsh_I_A:
+			case Mnemonic::Rsh_I_A:
+			case Mnemonic::Rrsh_I_A:
+			case Mnemonic::And_I_A:
+			case Mnemonic::Or_I_A:
+			case Mnemonic::Xor_I_A:
+			case Mnemonic::Eq_I_A:
+			case Mnemonic::Neq_I_A:
+			case Mnemonic::Lt_I_A:
+			case Mnemonic::Bt_I_A:
+			case Mnemonic::Test_I_A:
+			case Mnemonic::Alloc_I_A:
+			case Mnemonic::LoadDyn_I_A:
+			case Mnemonic::WriteDyn_I_A:
+			case Mnemonic::GetDynSize_I_A:
+			case Mnemonic::Regint_I_A:
+			case Mnemonic::RRegInt_I_A:
+			case Mnemonic::SetInstrPrivlg_I_A:
+			case Mnemonic::GetInstrPrivlg_I_A:
+			case Mnemonic::SetIntPrivlg_I_A:
+			case Mnemonic::GetIntPrivlg_I_A:
+			case Mnemonic::SetIntExecPrivlg_I_A:
+			case Mnemonic::GetIntExecPrivlg_I_A:
+			case Mnemonic::SetExtPrivlg_I_A:
+			case Mnemonic::GetExtPrivlg_I_A:
+			case Mnemonic::PCall_I_A:
+			case Mnemonic::RPCall_I_A:
+			case Mnemonic::PNtvCall_I_A:
+				return { OperandKind::Indirect, OperandKind::Address };
+
+			case Mnemonic::Mov_I_I:
+			case Mnemonic::Move_I_I:
+			case Mnemonic::Movne_I_I:
+			case Mnemonic::Movz_I_I:
+			case Mnemonic::Movnz_I_I:
+			case Mnemonic::Laddr_I_I:
+			case Mnemonic::Loadload_I_I:
+			case Mnemonic::Vcall_I_I:
+			case Mnemonic::RVcall_I_I:
+			case Mnemonic::GetNtvId_I_I:
+			case Mnemonic::Xchg_I_I:
+			case Mnemonic::Hotpatch_I_I:
+			case Mnemonic::RHotpatch_I_I:
+			case Mnemonic::IsExtEnabled_I_I:
+			case Mnemonic::SetSegmntAccs_I_I:
+			case Mnemonic::GetSegmntAccs_I_I:
+			case Mnemonic::Add_I_I:
+			case Mnemonic::Sub_I_I:
+			case Mnemonic::Mul_I_I:
+			case Mnemonic::Div_I_I:
+			case Mnemonic::Mod_I_I:
+			case Mnemonic::Lsh_I_I:
+			case Mnemonic::Rlsh_I_I:
+			case Mnemonic::Rsh_I_I:
+			case Mnemonic::Rrsh_I_I:
+			case Mnemonic::And_I_I:
+			case Mnemonic::Or_I_I:
+			case Mnemonic::Xor_I_I:
+			case Mnemonic::Eq_I_I:
+			case Mnemonic::Neq_I_I:
+			case Mnemonic::Lt_I_I:
+			case Mnemonic::Bt_I_I:
+			case Mnemonic::Test_I_I:
+			case Mnemonic::Alloc_I_I:
+			case Mnemonic::LoadDyn_I_I:
+			case Mnemonic::WriteDyn_I_I:
+			case Mnemonic::GetDynSize_I_I:
+			case Mnemonic::Regint_I_I:
+			case Mnemonic::RRegInt_I_I:
+			case Mnemonic::SetInstrPrivlg_I_I:
+			case Mnemonic::GetInstrPrivlg_I_I:
+			case Mnemonic::SetIntPrivlg_I_I:
+			case Mnemonic::GetIntPrivlg_I_I:
+			case Mnemonic::SetIntExecPrivlg_I_I:
+			case Mnemonic::GetIntExecPrivlg_I_I:
+			case Mnemonic::SetExtPrivlg_I_I:
+			case Mnemonic::GetExtPrivlg_I_I:
+			case Mnemonic::PCall_I_I:
+			case Mnemonic::RPCall_I_I:
+			case Mnemonic::PNtvCall_I_I:
+				return { OperandKind::Indirect, OperandKind::Indirect };
+
+			case Mnemonic::Mov_I_V:
+			case Mnemonic::Move_I_V:
+			case Mnemonic::Movne_I_V:
+			case Mnemonic::Movz_I_V:
+			case Mnemonic::Movnz_I_V:
+			case Mnemonic::Vcall_I_V:
+			case Mnemonic::RVcall_I_V:
+			case Mnemonic::IsExtEnabled_I_V:
+			case Mnemonic::SetSegmntAccs_I_V:
+			case Mnemonic::GetSegmntAccs_I_V:
+			case Mnemonic::Add_I_V:
+			case Mnemonic::Sub_I_V:
+			case Mnemonic::Mul_I_V:
+			case Mnemonic::Div_I_V:
+			case Mnemonic::Mod_I_V:
+			case Mnemonic::Lsh_I_V:
+			case Mnemonic::Rlsh_I_V:
+			case Mnemonic::Rsh_I_V:
+			case Mnemonic::Rrsh_I_V:
+			case Mnemonic::And_I_V:
+			case Mnemonic::Or_I_V:
+			case Mnemonic::Xor_I_V:
+			case Mnemonic::Eq_I_V:
+			case Mnemonic::Neq_I_V:
+			case Mnemonic::Lt_I_V:
+			case Mnemonic::Bt_I_V:
+			case Mnemonic::Test_I_V:
+			case Mnemonic::Alloc_I_V:
+			case Mnemonic::LoadDyn_I_V:
+			case Mnemonic::WriteDyn_I_V:
+			case Mnemonic::GetDynSize_I_V:
+			case Mnemonic::SetInstrPrivlg_I_V:
+			case Mnemonic::GetInstrPrivlg_I_V:
+			case Mnemonic::SetIntPrivlg_I_V:
+			case Mnemonic::GetIntPrivlg_I_V:
+			case Mnemonic::SetIntExecPrivlg_I_V:
+			case Mnemonic::GetIntExecPrivlg_I_V:
+			case Mnemonic::SetExtPrivlg_I_V:
+			case Mnemonic::GetExtPrivlg_I_V:
+			case Mnemonic::PCall_I_V:
+			case Mnemonic::RPCall_I_V:
+			case Mnemonic::PNtvCall_I_V:
+				return { OperandKind::Indirect, OperandKind::Value };
+
+			case Mnemonic::Push_I:
+			case Mnemonic::Pop_I:
+			case Mnemonic::Inc_I:
+			case Mnemonic::Dec_I:
+			case Mnemonic::Call_I:
+			case Mnemonic::RCall_I:
+			case Mnemonic::Read_I:
+			case Mnemonic::Readstr_I:
+			case Mnemonic::Print_I:
+			case Mnemonic::PrintS_I:
+			case Mnemonic::PrintC_I:
+			case Mnemonic::Printstr_I:
+			case Mnemonic::Jmp_I:
+			case Mnemonic::Jb_I:
+			case Mnemonic::Jnb_I:
+			case Mnemonic::Jbe_I:
+			case Mnemonic::Jnbe_I:
+			case Mnemonic::Jl_I:
+			case Mnemonic::Jnl_I:
+			case Mnemonic::Jle_I:
+			case Mnemonic::Jnle_I:
+			case Mnemonic::Jz_I:
+			case Mnemonic::Jnz_I:
+			case Mnemonic::Je_I:
+			case Mnemonic::Jne_I:
+			case Mnemonic::RJmp_I:
+			case Mnemonic::RJb_I:
+			case Mnemonic::RJnb_I:
+			case Mnemonic::RJbe_I:
+			case Mnemonic::RJnbe_I:
+			case Mnemonic::RJl_I:
+			case Mnemonic::RJnl_I:
+			case Mnemonic::RJle_I:
+			case Mnemonic::RJnle_I:
+			case Mnemonic::RJz_I:
+			case Mnemonic::RJnz_I:
+			case Mnemonic::RJe_I:
+			case Mnemonic::RJne_I:
+			case Mnemonic::Time_I:
+			case Mnemonic::Time64_I:
+			case Mnemonic::ICount_I:
+			case Mnemonic::ICount64_I:
+			case Mnemonic::ExecInstr_I:
+			case Mnemonic::NtvCall_I:
+			case Mnemonic::EnableExt_I:
+			case Mnemonic::DisableExt_I:
+			case Mnemonic::Not_I:
+			case Mnemonic::Dealloc_I:
+			case Mnemonic::DynOffset_I:
+			case Mnemonic::Raise_I:
+			case Mnemonic::ICountInt64_I:
+			case Mnemonic::RICountInt64_I:
+			case Mnemonic::GetPrivlg_I:
+			case Mnemonic::SetPrivlg_I:
+			case Mnemonic::MvSignFlag_I:
+			case Mnemonic::MvInfFlag_I:
+			case Mnemonic::MvNanFlag_I:
+				return { OperandKind::Indirect, OperandKind::None };
+
+			case Mnemonic::Vcall_V_R:
+			case Mnemonic::RVcall_V_R:
+			case Mnemonic::SetSegmntAccs_V_R:
+			case Mnemonic::WriteDyn_V_R:
+			case Mnemonic::RegInt_V_R:
+			case Mnemonic::RRegInt_V_R:
+			case Mnemonic::SetInstrPrivlg_V_R:
+			case Mnemonic::SetIntPrivlg_V_R:
+			case Mnemonic::SetIntExecPrivlg_V_R:
+			case Mnemonic::SetExtPrivlg_V_R:
+			case Mnemonic::PNtvCall_V_R:
+				return { OperandKind::Value, OperandKind::Register };
+
+			case Mnemonic::Vcall_V_A:
+			case Mnemonic::RVcall_V_A:
+			case Mnemonic::SetSegmntAccs_V_A:
+			case Mnemonic::WriteDyn_V_A:
+			case Mnemonic::Regint_V_A:
+			case Mnemonic::RRegInt_V_A:
+			case Mnemonic::SetInstrPrivlg_V_A:
+			case Mnemonic::SetIntPrivlg_V_A:
+			case Mnemonic::SetIntExecPrivlg_V_A:
+			case Mnemonic::SetExtPrivlg_V_A:
+			case Mnemonic::PNtvCall_V_A:
+				return { OperandKind::Value, OperandKind::Address };
+
+			case Mnemonic::Vcall_V_I:
+			case Mnemonic::RVcall_V_I:
+			case Mnemonic::SetSegmntAccs_V_I:
+			case Mnemonic::WriteDyn_V_I:
+			case Mnemonic::Regint_V_I:
+			case Mnemonic::RRegInt_V_I:
+			case Mnemonic::SetInstrPrivlg_V_I:
+			case Mnemonic::SetIntPrivlg_V_I:
+			case Mnemonic::SetIntExecPrivlg_V_I:
+			case Mnemonic::SetExtPrivlg_V_I:
+			case Mnemonic::PNtvCall_V_I:
+				return { OperandKind::Value, OperandKind::Indirect };
+
+			case Mnemonic::Vcall_V_V:
+			case Mnemonic::RVcall_V_V:
+			case Mnemonic::SetSegmntAccs_V_V:
+			case Mnemonic::WriteDyn_V_V:
+			case Mnemonic::SetInstrPrivlg_V_V:
+			case Mnemonic::SetIntPrivlg_V_V:
+			case Mnemonic::SetIntExecPrivlg_V_V:
+			case Mnemonic::SetExtPrivlg_V_V:
+			case Mnemonic::PNtvCall_V_V:
+				return { OperandKind::Value, OperandKind::Value };
+
+			case Mnemonic::Push_V:
+			case Mnemonic::Print_V:
+			case Mnemonic::PrintS_V:
+			case Mnemonic::PrintC_V:
+			case Mnemonic::NtvCall_V:
+			case Mnemonic::EnableExt_V:
+			case Mnemonic::DisableExt_V:
+			case Mnemonic::DynOffset_V:
+			case Mnemonic::Raise_V:
+			case Mnemonic::DisableInt_V:
+			case Mnemonic::EnableInt_V:
+			case Mnemonic::ICountInt_V:
+			case Mnemonic::RICountInt_V:
+			case Mnemonic::SetPrivlg_V:
+				return { OperandKind::Value, OperandKind::None };
+
+			case Mnemonic::FpMov_R_R:
+			case Mnemonic::FpAdd_R_R:
+			case Mnemonic::FpSub_R_R:
+			case Mnemonic::FpMul_R_R:
+			case Mnemonic::FpDiv_R_R:
+			case Mnemonic::FpTest_R_R:
+			case Mnemonic::FpMod_R_R:
+			case Mnemonic::FpSin_R_R:
+			case Mnemonic::FpCos_R_R:
+			case Mnemonic::FpTan_R_R:
+			case Mnemonic::FpLn_R_R:
+			case Mnemonic::FpLog2_R_R:
+			case Mnemonic::FpLog10_R_R:
+			case Mnemonic::FpPow_R_R:
+			case Mnemonic::FpRoot_R_R:
+				return { OperandKind::FpRegister, OperandKind::FpRegister };
+
+			case Mnemonic::FpMov_R_V:
+			case Mnemonic::FpAdd_R_V:
+			case Mnemonic::FpSub_R_V:
+			case Mnemonic::FpMul_R_V:
+			case Mnemonic::FpDiv_R_V:
+			case Mnemonic::FpTest_R_V:
+			case Mnemonic::FpMod_R_V:
+			case Mnemonic::FpSin_R_V:
+			case Mnemonic::FpCos_R_V:
+			case Mnemonic::FpTan_R_V:
+			case Mnemonic::FpLn_R_V:
+			case Mnemonic::FpLog2_R_V:
+			case Mnemonic::FpLog10_R_V:
+			case Mnemonic::FpPow_R_V:
+			case Mnemonic::FpRoot_R_V:
+				return { OperandKind::FpRegister, OperandKind::FpValue };
+
+			case Mnemonic::FpSign_R:
+			case Mnemonic::FpRound_R:
+			case Mnemonic::FpFloor_R:
+			case Mnemonic::FpCeil_R:
+			case Mnemonic::FpNan_R:
+			case Mnemonic::FpInf_R:
+			case Mnemonic::FpPi_R:
+			case Mnemonic::FpE_R:
+			case Mnemonic::FpCstLn2_R:
+			case Mnemonic::FpCstLn10_R:
+			case Mnemonic::FpCstLog10_R:
+			case Mnemonic::FpRoot_R:
+			case Mnemonic::FpCsqrt_R:
+			case Mnemonic::FpSq_R:
+			case Mnemonic::FpExp_R:
+			case Mnemonic::FpPrint_R:
+				return { OperandKind::FpRegister, OperandKind::None };
+
+			case Mnemonic::FpTest_V_R:
+				return { OperandKind::FpValue, OperandKind::FpRegister };
+
+			case Mnemonic::FpTest_V_V:
+				return { OperandKind::FpValue, OperandKind::FpValue };
+
+			case Mnemonic::FpSign_V:
+			case Mnemonic::FpPrint_V:
+				return { OperandKind::FpValue, OperandKind::None };
+
+			default:
+				return { OperandKind::None, OperandKind::None };
+		}
+	}
+
+	//Whether the mnemonic jumps or calls to the address given by its first operand
+	constexpr bool isDirectJump(Mnemonic m) {
+		if (m >= Mnemonic::Jmp_A && m <= Mnemonic::Jne_A)
+			return (static_cast<uint32_t>(m) - static_cast<uint32_t>(Mnemonic::Jmp_A)) % 3 == 0;
+		return m == Mnemonic::Call_A;
+	}
+
+	//Whether the mnemonic jumps or calls by the displacement given by its first operand,
+	//taken from the address of the following instruction
+	constexpr bool isRelativeJump(Mnemonic m) {
+		if (m >= Mnemonic::RJmp_A && m <= Mnemonic::RJne_A)
+			return (static_cast<uint32_t>(m) - static_cast<uint32_t>(Mnemonic::RJmp_A)) % 3 == 0;
+		return m == Mnemonic::RCall_A;
+	}
+}
+
+#endif	//COMMON_OPERAND_KINDS_HEADER_H_
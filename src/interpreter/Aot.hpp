@@ -0,0 +1,140 @@
+#pragma once
+
+#ifndef INTERPRETER_AOT_HEADER_H_
+#define INTERPRETER_AOT_HEADER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../common/Instruction.hpp"
+
+namespace sbl::vm {
+	/*
+		Ahead of time compiled program images, enabled by SBL_AOT(see Config.hpp).
+
+		sbl-aot(see src/aot) translates a program image into a C++ translation unit
+		with one function per code region of the program. The translation unit registers
+		its AotModule under the hash of the image when it gets linked into the program
+		running the VM, and VM::run then runs the compiled regions of the image instead
+		of interpreting them.
+
+		Every block start of a region is an entry point of it. The interpreter enters
+		a region through the decoded instruction of the entry point, after it has
+		counted and checked that instruction. The region keeps running for as long as
+		the control stays in it, counting and checking every instruction through AotFrame
+		the same way the interpreter does, and returns to the interpreter otherwise.
+		Instructions the region does not translate on its own run through the runners
+		of the VM, so the semantics are the same as when interpreting.
+
+		The compiled code is only valid for the image it was translated from, so the VM
+		drops the module once a segment of the program is written to, or gets any other
+		access than Executable.
+	*/
+
+	class VM;
+	class AotFrame;
+
+	//Runs the region from the entry point VM::instrPtr - 3 points to.
+	//Returns false if the execution should not continue
+	using AotFunction = bool (*)(AotFrame& f);
+
+	struct AotRegion {
+		uint32_t address;		//Address of the entry point
+		AotFunction function;
+	};
+
+	struct AotModule {
+		uint64_t imageHash;		//aotImageHash of the image the module was compiled from
+		uint64_t imageSize;		//Number of uint32_ts of the image
+		const AotRegion* regions;	//Sorted by address
+		size_t regionCount;
+	};
+
+	//FNV-1a over the words of a program image, header included
+	inline uint64_t aotImageHash(const std::vector<uint32_t>& stream) {
+		uint64_t hash = 0xcbf29ce484222325ull;
+		for (auto word : stream) {
+			for (int i = 0; i < 4; ++i) {
+				hash ^= (word >> (i * 8)) & 0xFF;
+				hash *= 0x100000001b3ull;
+			}
+		}
+		return hash;
+	}
+
+	inline std::vector<const AotModule*>& aotModules() {
+		static std::vector<const AotModule*> modules;
+		return modules;
+	}
+
+	//Makes the module available to every VM, returns true so that compiled translation units
+	//can register themselves by initializing a static variable with it
+	inline bool registerAotModule(const AotModule& module) {
+		aotModules().push_back(&module);
+		return true;
+	}
+
+	//Returns the module compiled from the image, or nullptr if there is none
+	inline const AotModule* findAotModule(const std::vector<uint32_t>& stream) {
+		auto& modules = aotModules();
+		if (modules.empty())
+			return nullptr;
+
+		auto hash = aotImageHash(stream);
+		for (auto module : modules) {
+			if (module->imageHash == hash && module->imageSize == stream.size())
+				return module;
+		}
+		return nullptr;
+	}
+
+	/*
+		Interface of the VM for the compiled regions, defined at the end of VM.hpp.
+
+		enter and enterRun count and check instructions the way the interpreter does,
+		and return false if the region has to give the control back to the interpreter
+		instead, with instrPtr pointing to the instruction that has not been entered.
+		proceed tells the region what to return then.
+	*/
+	class AotFrame {
+		VM& vm;
+		//Call depth the region has been entered at, the region leaves once it changes
+		uint32_t depth;
+	public:
+		uint32_t* const r;		//Integer registers of the VM
+		bool proceed = true;
+
+		explicit AotFrame(VM& vm);
+
+		AotFrame(const AotFrame&) = delete;
+		AotFrame& operator=(const AotFrame&) = delete;
+
+		//Address of the entry point the region has been entered at
+		uint32_t start() const;
+		//Address of the next instruction to run
+		uint32_t next() const;
+
+		//Counts and checks the instruction at address, and moves past it
+		bool enter(uint32_t address);
+		//Counts the instructions at address, which neither fail nor transfer control
+		//other than by the last one being a direct or relative jump, and moves past them
+		template <size_t N>
+		bool enterRun(uint32_t address, const cmn::Mnemonic (&mnemonics)[N]);
+
+		//Runs the instruction entered last through its runner. Returns false if the execution
+		//did not continue with the instruction at next
+		bool perform(uint32_t next);
+		//Whether the region may continue at next after perform returned false
+		bool resume() const;
+
+		//Leaves the region for the interpreter to continue at address
+		bool jump(uint32_t address);
+
+		void test(uint32_t left, uint32_t right);
+		//Whether the conditional direct or relative jump m jumps
+		bool taken(cmn::Mnemonic m) const;
+	};
+}
+
+#endif	//INTERPRETER_AOT_HEADER_H_
@@ -20,6 +20,18 @@ namespace sbl::vm {
 		return first < rightMin ? first : rightMin;
 	}
 
+	//Features of the VM a program declares to need, see CompiledHeader::features
+	enum ProgramFeatures : uint32_t {
+		FeaturePrivileges = 1 << 0,		//Privilege extension, privilege checks of instructions and interrupts
+		FeatureInterrupts = 1 << 1,		//Interrupt extension and the instruction count interrupt
+
+		AllFeatures = FeaturePrivileges | FeatureInterrupts,
+
+		//Set if the other bits are meaningful. Headers without it
+		//come from before the field existed and get every feature
+		FeaturesDeclared = 1u << 31,
+	};
+
 	struct CompiledHeader {
 		uint32_t version;			//Version of the VM, currently required to be set to 0
 		uint32_t signature;			//Fixed signature identifying this to be SBL bytecode file
@@ -30,8 +42,10 @@ namespace sbl::vm {
 		uint32_t staticBlockSize;	//Number of bytes the globals that are not executable but still part of the
 									//program image will take
 		uint32_t programSize;		//Number of bytes the executable portion of the program image will take
+		uint32_t features;			//ProgramFeatures the program needs, the VM picks the cheapest
+									//profile providing them(see Profile.hpp)
 
-		std::array<uint32_t, 64 - 7> padding;
+		std::array<uint32_t, 64 - 8> padding;
 									//Padding for up to 64 uint32_ts. Reserved for future use
 									//All of these have to be set to 0
 
@@ -41,7 +55,7 @@ namespace sbl::vm {
 		 */
 		constexpr CompiledHeader() noexcept : version(0), signature(0), startAddress(0), stackSize(0),
 												heapPtrCount(0), staticBlockSize(0), 
-												programSize(0), padding() {}
+												programSize(0), features(0), padding() {}
 
 		constexpr CompiledHeader(const CompiledHeader&) noexcept = default;
 		constexpr CompiledHeader(CompiledHeader&&) noexcept = default;
@@ -54,10 +68,10 @@ namespace sbl::vm {
 		constexpr CompiledHeader(uint32_t ver, uint32_t _sig,
 			uint32_t startAddr,
 			uint32_t stack, uint32_t globals, uint32_t heap,
-			uint32_t blockSize, uint32_t program_size)
+			uint32_t blockSize, uint32_t program_size, uint32_t feats = 0)
 				: version(ver), signature(_sig), startAddress(startAddr),
 					stackSize(stack), heapPtrCount(heap),
-					staticBlockSize(blockSize), programSize(program_size), padding() {}
+					staticBlockSize(blockSize), programSize(program_size), features(feats), padding() {}
 
 		constexpr bool _allPadding(uint32_t initValue) const {
 			for (auto& x : padding)
@@ -67,9 +81,15 @@ namespace sbl::vm {
 
 		constexpr bool validate() const {
 			return signature == 'sblx' && version == 0 &&
+				!(features & ~(AllFeatures | FeaturesDeclared)) &&
 				_allPadding(0);
 		}
 
+		//Features the program needs
+		constexpr uint32_t requiredFeatures() const {
+			return (features & FeaturesDeclared) ? features & AllFeatures : AllFeatures;
+		}
+
 		void fromStream(const std::vector<uint32_t>& stream) {
 			if (stream.size() < sizeof(*this))
 				return;
@@ -81,9 +101,10 @@ namespace sbl::vm {
 			heapPtrCount = stream[4];
 			staticBlockSize = stream[5];
 			programSize = stream[6];
+			features = stream[7];
 
 			for (int i = 0; i < padding.size(); ++i) {
-				padding[i] = stream[i + 7];
+				padding[i] = stream[i + 8];
 			}
 
 
@@ -138,6 +159,8 @@ namespace sbl::vm {
 			staticBlockSize = oneByte(view[0], 24) | oneByte(view[1], 16) | oneByte(view[2], 8) | oneByte(view[3], 0);
 			view.remove_prefix(4);
 			programSize = oneByte(view[0], 24) | oneByte(view[1], 16) | oneByte(view[2], 8) | oneByte(view[3], 0);
+			view.remove_prefix(4);
+			features = oneByte(view[0], 24) | oneByte(view[1], 16) | oneByte(view[2], 8) | oneByte(view[3], 0);
 
 
 			//If the total size of the staticm memory block and program block is bigger
@@ -0,0 +1,141 @@
+#pragma once
+
+#ifndef INTERPRETER_CONFIG_HEADER_H_
+#define INTERPRETER_CONFIG_HEADER_H_
+
+/*
+	Build time configuration of the interpreter.
+
+	Every option below can either be uncommented here, or defined
+	on the command line of the compiler(/D on MSVC, -D on GCC and Clang).
+*/
+
+/*
+	SBL_DIRECT_THREADED
+
+	Replaces the runners[] + per chunk switch dispatch used by VM::_loop with
+	a direct threaded engine(see extensions/Threaded.cpp). Every mnemonic
+	gets its own handler label and every handler jumps straight into the handler
+	of the next instruction, so there is one indirect branch per executed instruction
+	instead of two, and each of them is predicted separately.
+
+	Requires labels as values(computed goto), which is supported by GCC and Clang,
+	but not by MSVC.
+*/
+//#define SBL_DIRECT_THREADED
+
+#if defined(SBL_DIRECT_THREADED) && defined(_MSC_VER) && !defined(__clang__)
+#	error "SBL_DIRECT_THREADED requires computed goto, which is not supported by MSVC."
+#endif
+
+/*
+	SBL_TAIL_CALL
+
+	Replaces the runners[] + per chunk switch dispatch used by VM::_loop with
+	a tail call engine(see extensions/TailCall.cpp). Every mnemonic gets its own
+	handler function, which ends by fetching the next instruction and tail calling
+	its handler through a table, so there is one indirect jump per executed instruction
+	without relying on computed goto.
+
+	Clang guarantees the tail calls with [[clang::musttail]], and so does GCC 15
+	and newer with [[gnu::musttail]]. Older GCC turns them into sibling calls when
+	optimizing(-O2, or -foptimize-sibling-calls), unoptimized builds grow the stack
+	with every executed instruction.
+	Cannot be combined with SBL_DIRECT_THREADED.
+*/
+//#define SBL_TAIL_CALL
+
+#if defined(SBL_TAIL_CALL) && defined(SBL_DIRECT_THREADED)
+#	error "SBL_TAIL_CALL and SBL_DIRECT_THREADED are two different dispatch engines, pick one."
+#endif
+
+/*
+	SBL_NO_FUSION
+
+	Disables the superinstructions(see Fusion.hpp), every instruction
+	of a decoded segment is then executed on its own.
+*/
+//#define SBL_NO_FUSION
+
+/*
+	SBL_NO_BASIC_BLOCKS
+
+	Disables the basic blocks(see VM::_startBlock), every instruction
+	of a decoded segment is then fetched and checked on its own.
+*/
+//#define SBL_NO_BASIC_BLOCKS
+
+/*
+	SBL_JIT
+
+	Compiles hot basic blocks into x86-64 machine code(see Jit.hpp).
+	Only Arithmetic, Logical and the simple Basic instructions are compiled,
+	everything else keeps running in the interpreter.
+
+	Requires x86-64 Linux and the basic blocks.
+*/
+//#define SBL_JIT
+
+#if defined(SBL_JIT) && !(defined(__x86_64__) && defined(__linux__))
+#	error "SBL_JIT is only supported on x86-64 Linux."
+#endif
+
+#if defined(SBL_JIT) && defined(SBL_NO_BASIC_BLOCKS)
+#	error "SBL_JIT compiles basic blocks and cannot be used with SBL_NO_BASIC_BLOCKS."
+#endif
+
+/*
+	SBL_AOT
+
+	Runs the program images compiled to C++ by sbl-aot(see Aot.hpp) instead of
+	interpreting them. The translation units generated by sbl-aot require it,
+	and register themselves when they are linked into the program running the VM.
+	Images without a compiled module run in the interpreter as usual.
+*/
+//#define SBL_AOT
+
+/*
+	SBL_NO_EXCEPTIONS
+
+	Raises the errors of the interpreter(see VM::_raise) with longjmp into the trap
+	set up by VM::_loop, instead of throwing them as ErrorCode and catching them there.
+	The interpreter then neither throws nor catches anything, and can be built with
+	exceptions disabled(-fno-exceptions on GCC and Clang), so none of the helpers
+	that can raise an error needs unwinding code.
+	A failed allocation while loading a program then ends the process instead
+	of failing the load.
+
+	Native functions calling into the VM through State are skipped over by the longjmp
+	when the call raises an error, so they must not keep objects with destructors
+	alive across such calls. State::runFunction and State::raiseInterrupt set up
+	their own trap and return false when the code they run raises an error.
+*/
+//#define SBL_NO_EXCEPTIONS
+
+//Keeps a function out of its callers, used to keep the dispatch loop
+//out of the function calling setjmp(see VM::_guarded)
+#if defined(_MSC_VER) && !defined(__clang__)
+#	define SBL_NOINLINE __declspec(noinline)
+#else
+#	define SBL_NOINLINE __attribute__((noinline))
+#endif
+
+//Same as SBL_NOINLINE, and tells the compiler the function is rarely called,
+//so the paths leading to it get laid out away from the hot code
+#if defined(_MSC_VER) && !defined(__clang__)
+#	define SBL_COLD __declspec(noinline)
+#else
+#	define SBL_COLD __attribute__((noinline, cold))
+#endif
+
+//Makes the call in the return statement it precedes a guaranteed tail call,
+//empty where the compiler has no way of guaranteeing it(see SBL_TAIL_CALL)
+#if defined(__clang__)
+#	define SBL_MUSTTAIL [[clang::musttail]]
+#elif defined(__GNUC__) && __GNUC__ >= 15
+#	define SBL_MUSTTAIL [[gnu::musttail]]
+#else
+#	define SBL_MUSTTAIL
+#endif
+
+#endif	//INTERPRETER_CONFIG_HEADER_H_
@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef INTERPRETER_FUSION_HEADER_H_
+#define INTERPRETER_FUSION_HEADER_H_
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+#include "../common/Instruction.hpp"
+
+namespace sbl::vm {
+	/*
+		Superinstructions
+
+		Adjacent instructions of a decoded segment that match one of the fusionPatterns
+		are executed as a single group(see VM::_performFused), skipping the fetch, count
+		and privilege check of every instruction but the first one.
+
+		A group is only executed fused if none of its instructions would trigger
+		the instruction count interrupt and every one of them passes the privilege check.
+		Otherwise, the instructions are executed one by one as usual.
+		The group is counted as a whole ahead of time, but every instruction in it still
+		moves instrPtr and lastExecuted before it runs, and whatever did not run is taken
+		back from instrCount when the group is left early, so errors raised by any of them
+		report the same state as they would without the fusion.
+	*/
+
+	constexpr uint32_t MaxFusionLength = 3;
+
+	enum class FusedKind : uint8_t {
+		//Runs the runners of the instructions one after another.
+		//Works for any pattern, as long as only the last instruction
+		//changes privileges, interrupts or access rights of segments,
+		//or reads the instruction count.
+		//Stops as soon as an instruction leaves the group
+		Sequence,
+
+		//Test_R_R or Test_R_V followed by a relative conditional jump(RJ*_A)
+		TestBranch,
+
+		//Chain of Add, Sub and Mul instructions with _R_R or _R_V operands
+		RegisterArithmetic,
+	};
+
+	struct FusionPattern {
+		FusedKind kind;
+		uint32_t length;
+		std::array<cmn::Mnemonic, MaxFusionLength> mnemonics;
+	};
+
+	/*
+		Patterns are matched in order and the first one matching wins,
+		so longer patterns have to come before their prefixes.
+
+		New patterns found by profiling can be added here freely, the Sequence
+		kind accepts anything, the other kinds accept only the instructions listed
+		next to their definition.
+	*/
+	inline constexpr FusionPattern fusionPatterns[] = {
+		//Distance kernel, a - b squared
+		{ FusedKind::RegisterArithmetic, 3, { cmn::Mnemonic::Sub_R_R, cmn::Mnemonic::Sub_R_R, cmn::Mnemonic::Mul_R_R } },
+		{ FusedKind::RegisterArithmetic, 2, { cmn::Mnemonic::Mul_R_R, cmn::Mnemonic::Add_R_R } },
+		{ FusedKind::RegisterArithmetic, 2, { cmn::Mnemonic::Sub_R_R, cmn::Mnemonic::Mul_R_R } },
+		{ FusedKind::RegisterArithmetic, 2, { cmn::Mnemonic::Mul_R_R, cmn::Mnemonic::Mul_R_R } },
+		{ FusedKind::RegisterArithmetic, 2, { cmn::Mnemonic::Add_R_R, cmn::Mnemonic::Add_R_R } },
+		{ FusedKind::RegisterArithmetic, 2, { cmn::Mnemonic::Add_R_V, cmn::Mnemonic::Add_R_R } },
+
+		//Comparison followed by a conditional relative jump
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJb_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJnb_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJbe_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJnbe_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJl_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJle_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJe_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_R, cmn::Mnemonic::RJne_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_V, cmn::Mnemonic::RJb_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_V, cmn::Mnemonic::RJnb_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_V, cmn::Mnemonic::RJe_A } },
+		{ FusedKind::TestBranch, 2, { cmn::Mnemonic::Test_R_V, cmn::Mnemonic::RJne_A } },
+
+		//Walking an array through a register
+		{ FusedKind::Sequence, 2, { cmn::Mnemonic::Mov_R_I, cmn::Mnemonic::Inc_R } },
+		{ FusedKind::Sequence, 2, { cmn::Mnemonic::Mov_R_R, cmn::Mnemonic::Mov_R_R } },
+	};
+
+	constexpr uint32_t FusionPatternCount = static_cast<uint32_t>(std::size(fusionPatterns));
+}
+
+#endif	//INTERPRETER_FUSION_HEADER_H_
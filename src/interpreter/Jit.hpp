@@ -0,0 +1,349 @@
+#pragma once
+
+#ifndef INTERPRETER_JIT_HEADER_H_
+#define INTERPRETER_JIT_HEADER_H_
+
+#include "Config.hpp"
+
+#ifdef SBL_JIT
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <sys/mman.h>
+
+namespace sbl::vm {
+	/*
+		Baseline JIT, enabled by SBL_JIT(see Config.hpp).
+
+		Hot basic blocks of decoded segments(see VM::_startBlock) are translated into
+		x86-64 machine code by VM::_compileBlock, one template per instruction.
+		The code works on the registers and the memory of the VM directly and does not
+		call back into the VM, so everything it cannot do on its own, such as raising
+		an error, leaves the code through a side exit and is done by the interpreter.
+
+		The compiled code uses only the registers the System V calling convention lets
+		a function clobber:
+			rdi		JitContext*
+			r8		JitContext::registers
+			r9		JitContext::memory
+			r10		JitContext::segmentInfo
+			r11		JitContext::segmentCount
+			rsi		JitContext::controlByte
+			eax, ecx, edx	scratch
+
+		It returns the number of instructions it has executed and leaves instrPtr
+		pointing to the first instruction it has not.
+
+		Loops written with Loop and Endloop get a trace on top of that. Once the block
+		at the head of a loop gets hot, the path taken through one iteration of the body
+		is recorded(see VM::_startTrace) and compiled by VM::_compileTrace into code
+		that keeps iterating for as long as the body takes the same path.
+		Traces return the instructions executed by the last, unfinished iteration,
+		the finished iterations are counted in JitContext::iterations.
+	*/
+
+	//Instructions a block has to run through the interpreter before it gets compiled
+	constexpr uint16_t JitThreshold = 64;
+	//Longest loop body, in instructions executed per iteration, compiled into a trace
+	constexpr uint32_t MaxTraceLength = 256;
+	//Size of the executable memory shared by all compiled blocks of a program
+	constexpr size_t JitArenaSize = 4 * 1024 * 1024;
+
+	struct JitContext {
+		uint32_t* registers;
+		uint32_t* memory;
+		const uint8_t* segmentInfo;
+		uint64_t segmentCount;
+		uint32_t* controlByte;
+		//Iterations completed by a loop trace, see VM::_compileTrace
+		uint64_t iterations;
+		//Iterations a loop trace may start
+		uint64_t maxIterations;
+	};
+
+	using JitFunction = uint32_t(*)(JitContext*);
+
+	class X64Emitter {
+	public:
+		enum Reg : uint8_t {
+			Eax = 0,
+			Ecx = 1,
+			Edx = 2,
+		};
+
+		//Opcodes of the binary operations in their "op r/m32, r32" form,
+		//the "op r32, r/m32" form is always the one right after them
+		enum AluOp : uint8_t {
+			Add = 0x01,
+			Or = 0x09,
+			And = 0x21,
+			Sub = 0x29,
+			Xor = 0x31,
+			Cmp = 0x39,
+		};
+
+		//Condition codes of jcc and cmovcc
+		enum Cond : uint8_t {
+			Below = 0x2,
+			AboveEqual = 0x3,
+			Zero = 0x4,
+			NotZero = 0x5,
+			BelowEqual = 0x6,
+			Above = 0x7,
+		};
+
+		//Position of a rel32 field waiting for its target
+		using Fixup = size_t;
+		//Position in the code a jump can go back to
+		using Label = size_t;
+
+		const std::vector<uint8_t>& code() const {
+			return bytes;
+		}
+
+		size_t size() const {
+			return bytes.size();
+		}
+
+		void prologue() {
+			_emit({ 0x4C, 0x8B, 0x07 });		//mov r8, [rdi]
+			_emit({ 0x4C, 0x8B, 0x4F, 0x08 });	//mov r9, [rdi + 8]
+			_emit({ 0x4C, 0x8B, 0x57, 0x10 });	//mov r10, [rdi + 16]
+			_emit({ 0x4C, 0x8B, 0x5F, 0x18 });	//mov r11, [rdi + 24]
+			_emit({ 0x48, 0x8B, 0x77, 0x20 });	//mov rsi, [rdi + 32]
+		}
+
+		//mov reg, registers[regId]
+		void loadRegister(Reg reg, uint32_t regId) {
+			_emit({ 0x41, 0x8B, static_cast<uint8_t>(0x80 | reg << 3) });
+			_emit32(regId * 4);
+		}
+
+		//mov registers[regId], reg
+		void storeRegister(uint32_t regId, Reg reg) {
+			_emit({ 0x41, 0x89, static_cast<uint8_t>(0x80 | reg << 3) });
+			_emit32(regId * 4);
+		}
+
+		//mov dword registers[regId], value
+		void storeRegister(uint32_t regId, uint32_t value) {
+			_emit({ 0x41, 0xC7, 0x80 });
+			_emit32(regId * 4);
+			_emit32(value);
+		}
+
+		//op registers[regId], reg
+		void aluRegister(AluOp op, uint32_t regId, Reg reg) {
+			_emit({ 0x41, op, static_cast<uint8_t>(0x80 | reg << 3) });
+			_emit32(regId * 4);
+		}
+
+		//op reg, registers[regId]
+		void aluFromRegister(AluOp op, Reg reg, uint32_t regId) {
+			_emit({ 0x41, static_cast<uint8_t>(op + 2), static_cast<uint8_t>(0x80 | reg << 3) });
+			_emit32(regId * 4);
+		}
+
+		//op dword registers[regId], value
+		void aluRegister(AluOp op, uint32_t regId, uint32_t value) {
+			//The /digit of the immediate form is the opcode of the register form divided by 8
+			_emit({ 0x41, 0x81, static_cast<uint8_t>(0x80 | (op >> 3) << 3) });
+			_emit32(regId * 4);
+			_emit32(value);
+		}
+
+		//cmp reg, value
+		void compare(Reg reg, uint32_t value) {
+			_emit({ 0x81, static_cast<uint8_t>(0xF8 | reg) });
+			_emit32(value);
+		}
+
+		//not dword registers[regId]
+		void notRegister(uint32_t regId) {
+			_emit({ 0x41, 0xF7, 0x90 });
+			_emit32(regId * 4);
+		}
+
+		//imul reg, registers[regId]
+		void mulFromRegister(Reg reg, uint32_t regId) {
+			_emit({ 0x41, 0x0F, 0xAF, static_cast<uint8_t>(0x80 | reg << 3) });
+			_emit32(regId * 4);
+		}
+
+		//imul reg, reg, value
+		void mul(Reg reg, uint32_t value) {
+			_emit({ 0x69, static_cast<uint8_t>(0xC0 | reg << 3 | reg) });
+			_emit32(value);
+		}
+
+		//mov reg, value
+		void move(Reg reg, uint32_t value) {
+			_emit(static_cast<uint8_t>(0xB8 | reg));
+			_emit32(value);
+		}
+
+		//cmovcc to, from
+		void moveIf(Cond cond, Reg to, Reg from) {
+			_emit({ 0x0F, static_cast<uint8_t>(0x40 | cond), static_cast<uint8_t>(0xC0 | to << 3 | from) });
+		}
+
+		//mov [rsi], reg
+		void storeControl(Reg reg) {
+			_emit({ 0x89, static_cast<uint8_t>(reg << 3 | 0x06) });
+		}
+
+		//test dword [rsi], mask
+		void testControl(uint32_t mask) {
+			_emit({ 0xF7, 0x06 });
+			_emit32(mask);
+		}
+
+		//Jumps to the returned fixup if the segment of the address in eax is out of range
+		//or lacks the access flag, leaves eax untouched
+		void checkAccess(uint32_t segmentShift, uint8_t flag, std::vector<Fixup>& failed) {
+			_emit({ 0x89, 0xC1 });							//mov ecx, eax
+			_emit({ 0xC1, 0xE9, static_cast<uint8_t>(segmentShift) });	//shr ecx, segmentShift
+			_emit({ 0x4C, 0x39, 0xD9 });					//cmp rcx, r11
+			failed.push_back(jumpIf(AboveEqual));
+			_emit({ 0x41, 0xF6, 0x04, 0x0A, flag });		//test byte [r10 + rcx], flag
+			failed.push_back(jumpIf(Zero));
+		}
+
+		//mov reg, [r9 + rax * 4]
+		void loadMemory(Reg reg) {
+			_emit({ 0x41, 0x8B, static_cast<uint8_t>(reg << 3 | 0x04), 0x81 });
+		}
+
+		//mov [r9 + rax * 4], reg
+		void storeMemory(Reg reg) {
+			_emit({ 0x41, 0x89, static_cast<uint8_t>(reg << 3 | 0x04), 0x81 });
+		}
+
+		//mov dword [r9 + rax * 4], value
+		void storeMemory(uint32_t value) {
+			_emit({ 0x41, 0xC7, 0x04, 0x81 });
+			_emit32(value);
+		}
+
+		//mov reg64, [rdi + offset]
+		void loadContext(Reg reg, uint8_t offset) {
+			_emit({ 0x48, 0x8B, static_cast<uint8_t>(0x47 | reg << 3), offset });
+		}
+
+		//cmp reg64, [rdi + offset]
+		void compareContext(Reg reg, uint8_t offset) {
+			_emit({ 0x48, 0x3B, static_cast<uint8_t>(0x47 | reg << 3), offset });
+		}
+
+		//inc qword [rdi + offset]
+		void incrementContext(uint8_t offset) {
+			_emit({ 0x48, 0xFF, 0x47, offset });
+		}
+
+		Label label() const {
+			return bytes.size();
+		}
+
+		//jmp rel32 back to the label
+		void jumpTo(Label target) {
+			_emit(0xE9);
+			_emit32(static_cast<uint32_t>(target - (bytes.size() + 4)));
+		}
+
+		//jcc rel32, the target is set by bind
+		Fixup jumpIf(Cond cond) {
+			_emit({ 0x0F, static_cast<uint8_t>(0x80 | cond) });
+			_emit32(0);
+			return bytes.size() - 4;
+		}
+
+		//Points the jump of fixup at the current end of the code
+		void bind(Fixup fixup) {
+			auto rel = static_cast<uint32_t>(bytes.size() - (fixup + 4));
+			std::memcpy(&bytes[fixup], &rel, sizeof(rel));
+		}
+
+		//Writes instrPtr and returns the executed instruction count
+		void exit(uint32_t instrPtrId, uint32_t nextAddress, uint32_t executed) {
+			storeRegister(instrPtrId, nextAddress);
+			move(Eax, executed);
+			_emit(0xC3);	//ret
+		}
+
+		void exit(uint32_t instrPtrId, Reg nextAddress, uint32_t executed) {
+			storeRegister(instrPtrId, nextAddress);
+			move(Eax, executed);
+			_emit(0xC3);	//ret
+		}
+
+	private:
+		std::vector<uint8_t> bytes;
+
+		void _emit(uint8_t byte) {
+			bytes.push_back(byte);
+		}
+
+		void _emit(std::initializer_list<uint8_t> list) {
+			bytes.insert(bytes.end(), list);
+		}
+
+		void _emit32(uint32_t value) {
+			for (int i = 0; i < 4; ++i)
+				bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+		}
+	};
+
+	//Executable memory the compiled blocks are placed into. The memory is only
+	//writable while a block is being copied into it, and is freed as a whole
+	class JitArena {
+	public:
+		JitArena() {}
+
+		JitArena(const JitArena&) = delete;
+		JitArena& operator=(const JitArena&) = delete;
+
+		~JitArena() {
+			if (base)
+				munmap(base, JitArenaSize);
+		}
+
+		//Copies the code into the arena, returns nullptr if there is no room left
+		JitFunction install(const std::vector<uint8_t>& code) {
+			if (!base) {
+				void* mem = mmap(nullptr, JitArenaSize, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (mem == MAP_FAILED)
+					return nullptr;
+				base = static_cast<uint8_t*>(mem);
+			}
+
+			if (code.size() > JitArenaSize - used)
+				return nullptr;
+
+			if (mprotect(base, JitArenaSize, PROT_READ | PROT_WRITE))
+				return nullptr;
+			auto at = base + used;
+			std::memcpy(at, code.data(), code.size());
+			mprotect(base, JitArenaSize, PROT_READ | PROT_EXEC);
+
+			//Keeps the start of every block aligned
+			used += (code.size() + 15) & ~size_t(15);
+			return reinterpret_cast<JitFunction>(at);
+		}
+
+		//Drops every installed block
+		void reset() {
+			used = 0;
+		}
+
+	private:
+		uint8_t* base = nullptr;
+		size_t used = 0;
+	};
+}
+
+#endif	//SBL_JIT
+
+#endif	//INTERPRETER_JIT_HEADER_H_
@@ -5,6 +5,8 @@
 
 #include <vector>
 
+#include "Config.hpp"
+
 namespace sbl::vm {
 	enum class SegmentAccessType : uint8_t {
 		None = 0,
@@ -143,37 +145,41 @@ namespace sbl::vm {
 			segmentInfo.clear();
 		}
 
-		bool addSegment(SegmentAccessType defaultAccess) {
+		//Runs the allocation, returns false if it failed.
+		//Without exceptions(see SBL_NO_EXCEPTIONS) a failed allocation ends the process
+		template <class Allocation>
+		bool _tryAllocate(Allocation&& allocation) {
+#ifdef SBL_NO_EXCEPTIONS
+			allocation();
+#else
 			try {
-				memory.insert(memory.end(), SegmentSize, 0);
-				segmentInfo.push_back({ defaultAccess });
+				allocation();
 			} catch (...) {
 				return false;
 			}
-
+#endif
 			return true;
 		}
 
+		bool addSegment(SegmentAccessType defaultAccess) {
+			return _tryAllocate([&] {
+				memory.insert(memory.end(), SegmentSize, 0);
+				segmentInfo.push_back({ defaultAccess });
+			});
+		}
+
 		bool addSegment(SegmentAccessType defaultAccess, Observer<const uint32_t> initValueArray) {
-			try {
+			return _tryAllocate([&] {
 				memory.insert(memory.end(), initValueArray, initValueArray + SegmentSize);
 				segmentInfo.push_back({ defaultAccess });
-			} catch (...) {
-				return false;
-			}
-			
-			return true;
+			});
 		}
 
 		bool addSegments(size_t count, SegmentAccessType defaultAccess) {
-			try {
+			return _tryAllocate([&] {
 				memory.insert(memory.end(), SegmentSize * count, 0);
 				segmentInfo.insert(segmentInfo.end(), count, { defaultAccess });
-			} catch (...) {
-				return false;
-			}
-
-			return true;
+			});
 		}
 
 		bool addSegments(size_t count, SegmentAccessType defaultAccess, Observer<const uint32_t> initValueArray) {
@@ -363,10 +369,19 @@ namespace sbl::vm {
 			segmentInfo[segmentId].segmentAccessFlags = newAccess;
 		}
 
+		Observer<uint32_t> baseAddress() {
+			return &memory[0];
+		}
+
 		const Observer<const uint32_t> baseAddress() const {
 			return &memory[0];
 		}
 
+		//Access flags of every segment, one byte per segment
+		Observer<const SegmentInformation> segmentInformation() const {
+			return segmentInfo.data();
+		}
+
 		uint32_t& _getNocheck(size_t addr) {
 			return memory[addr];
 		}
@@ -0,0 +1,57 @@
+#pragma once
+
+#ifndef INTERPRETER_PROFILE_HEADER_H_
+#define INTERPRETER_PROFILE_HEADER_H_
+
+#include <cstdint>
+
+#include "CompiledHeader.hpp"
+
+namespace sbl::vm {
+	//Bit of FeatureProfile::features marking the verified variants, kept clear of ProgramFeatures
+	constexpr uint32_t VerifiedProfile = 1u << 30;
+
+	/*
+		Feature profiles
+
+		The dispatch path of the VM(VM::_execute and everything it calls on the way
+		to the runner of an instruction) is instantiated once per profile, and the checks
+		of the features a profile leaves out are compiled out of its instantiation:
+			privileges	the privilege check of every instruction
+			interrupts	the instruction count interrupt
+			verified	the mnemonic and register checks of decoded instructions
+
+		VM::_initMemory picks the cheapest profile providing every feature the header
+		of the program declares(see CompiledHeader::features), and rejects programs
+		containing instructions of the extensions the profile leaves out.
+		Without any privilege changing instruction every privilege check passes, and
+		without ICountInt the instruction count interrupt never triggers, so the
+		instantiations behave exactly like the full one for the programs they accept.
+
+		Programs passing the verifier(see Verifier.hpp) run on the verified variant
+		of their profile.
+	*/
+	template <bool Privileges, bool Interrupts, bool Verified = false>
+	struct FeatureProfile {
+		static constexpr bool privileges = Privileges;
+		static constexpr bool interrupts = Interrupts;
+		static constexpr bool verified = Verified;
+
+		static constexpr uint32_t features = (Privileges ? FeaturePrivileges : 0)
+										   | (Interrupts ? FeatureInterrupts : 0)
+										   | (Verified ? VerifiedProfile : 0);
+
+		//Same profile with every check of the instructions in place
+		using Unverified = FeatureProfile<Privileges, Interrupts>;
+	};
+
+	using FullProfile = FeatureProfile<true, true>;
+	using NoPrivilegeProfile = FeatureProfile<false, true>;
+	using NoInterruptProfile = FeatureProfile<true, false>;
+	using MinimalProfile = FeatureProfile<false, false>;
+
+	template <class Profile>
+	using VerifiedOf = FeatureProfile<Profile::privileges, Profile::interrupts, true>;
+}
+
+#endif	//INTERPRETER_PROFILE_HEADER_H_
@@ -13,12 +13,21 @@
 #include <iostream>
 #include <memory>
 #include <iomanip>
+#include <algorithm>
+#include <csetjmp>
 
 #include "../common/Instruction.hpp"
 #include "../common/FixedVector.hpp"
+#include "../common/OperandKinds.hpp"
 
+#include "Config.hpp"
 #include "CompiledHeader.hpp"
 #include "Memory.hpp"
+#include "Fusion.hpp"
+#include "Profile.hpp"
+#include "Verifier.hpp"
+#include "Jit.hpp"
+#include "Aot.hpp"
 
 #include <limits.h>   // for CHAR_BIT
 
@@ -214,6 +223,7 @@ namespace sbl::vm {
 		//to the user in native functions
 		friend vm::State;
 		friend vm::DynamicMemoryHandler;
+		friend vm::AotFrame;
 
 		//Helper functions to disambiguate argument types
 		//depending on the instruction argument type
@@ -223,6 +233,10 @@ namespace sbl::vm {
 		struct FpRegister { uint32_t regId; };
 		struct Address { uint32_t addr; };
 		struct Indirect { uint32_t regId; };
+		//Register and indirect operands of decoded instructions,
+		//with the register already validated and resolved
+		struct ResolvedRegister { uint32_t* reg; };
+		struct ResolvedIndirect { uint32_t* reg; };
 
 		enum ControlFlags {
 			TestSmaller = 1 << 0,
@@ -238,6 +252,68 @@ namespace sbl::vm {
 			TestFloatInf = 1 << 10,
 		};
 
+		using InstrRunner = bool(VM::*)(Instruction*);
+
+		//Instruction from an executable segment decoded ahead of its execution,
+		//see _decode
+		struct DecodedInstruction {
+			enum Flags : uint8_t {
+				Decoded = 1 << 0,		//The entry holds a decoded instruction
+				ValidMnemonic = 1 << 1,	//The mnemonic belongs to one of the runners
+				Resolved = 1 << 2,		//Every register and indirect operand has its register resolved
+				FusionChecked = 1 << 3,	//The entry has been matched against the fusionPatterns
+				JitChecked = 1 << 4,	//The block starting at the entry has been given to _compileBlock
+				TraceChecked = 1 << 5,	//The loop starting at the entry has been recorded, see _startTrace
+			};
+
+			Instruction instr;
+			InstrRunner runner;
+			//Registers named by the operands, only set for register and indirect operands
+			uint32_t* regArg1;
+			uint32_t* regArg2;
+			uint8_t flags;
+			//Index + 1 of the fusion pattern starting at this instruction, 0 if there is none
+			uint8_t fusion;
+			//Number of instructions in the basic block starting at this instruction,
+			//this one included. Less than 2 if the instruction does not start a block
+			uint16_t blockLength;
+			//Highest privilege required by the instructions of the block,
+			//valid only while blockEpoch matches privilegeEpoch
+			uint8_t blockPrivilege;
+			uint32_t blockEpoch;
+#ifdef SBL_JIT
+			//Times the block starting at this instruction has been run by the interpreter
+			uint16_t hotness;
+			//Number of instructions compiled into jitCode
+			uint16_t jitLength;
+			JitFunction jitCode;
+			//Index + 1 of the trace of the loop starting at this instruction, 0 if there is none
+			uint16_t trace;
+#endif
+#ifdef SBL_AOT
+			//Compiled region the instruction is an entry point of, see Aot.hpp
+			AotFunction aot;
+#endif
+		};
+
+#ifdef SBL_JIT
+		//Loop body compiled by _compileTrace
+		struct LoopTrace {
+			JitFunction code;
+			//Instructions run by one iteration, in order
+			std::vector<Instruction*> instructions;
+			//Highest privilege required by the instructions,
+			//valid only while epoch matches privilegeEpoch
+			uint8_t privilege = 0;
+			uint32_t epoch = 0;
+		};
+#endif
+
+		struct DecodedSegment {
+			std::unique_ptr<DecodedInstruction[]> entries;
+			bool enabled = false;
+		};
+
 		uint64_t instrCount = 0;
 		uint64_t nextInstrCountInterrupt = 0;
 		uint32_t controlByte = 0;
@@ -293,11 +369,86 @@ namespace sbl::vm {
 		uint32_t lastExecSegment;
 		uint32_t dynamicOffset;
 
+		//Decoded instructions per segment. Only segments that are executable, but neither
+		//readable nor writable are decoded, because the program has no way of modifying them
+		//and their entries stay valid until the access rights of the segment change.
+		//The entries are kept around when the segment is disabled, as an entry may still be
+		//running when its own segment changes access
+		std::vector<DecodedSegment> decodedSegments;
+		//Offset modulo 3 of the instructions decoded ahead of time, taken from the entry point
+		uint32_t decodeAlignment = 0;
+
+		//Instructions already counted in instrCount, but not yet executed, because
+		//a basic block or a fused group got counted as a whole. If the execution leaves
+		//them early, they are taken back from instrCount by _dropPrecharged
+		uint32_t precharged = 0;
+		//Next instruction of the running basic block, valid while precharged is not 0
+		DecodedInstruction* blockNext = nullptr;
+		//Changes every time instrPrivileges changes, see DecodedInstruction::blockEpoch
+		uint32_t privilegeEpoch = 0;
+		//Features of the profile the loaded program runs with, see Profile.hpp
+		uint32_t profileFeatures = AllFeatures;
+		//Result of verifying the loaded program, see Verifier.hpp
+		Verification verification;
+#ifdef SBL_NO_EXCEPTIONS
+		//Where _raise jumps to, see _guarded
+		std::jmp_buf* trap = nullptr;
+#endif
+
+#ifdef SBL_JIT
+		//Code of the compiled blocks, the entries pointing into it are dropped
+		//together with their decoded segments
+		JitArena jitArena;
+		//A trace may run through several segments, so all of them are dropped
+		//as soon as any decoded segment changes
+		std::vector<LoopTrace> traces;
+		//Instructions dispatched since the recording of a loop started, with their
+		//addresses. The first one is the head of the loop, see _startTrace
+		std::vector<std::pair<DecodedInstruction*, uint32_t>> traceRecord;
+		bool traceRecording = false;
+#endif
+#ifdef SBL_AOT
+		//Compiled module of the loaded program image, dropped as soon as the program
+		//segments stop matching the image it was compiled from
+		const AotModule* aotModule = nullptr;
+#endif
+
+		//Leaves the execution after an error has been stored into error.
+		//Throws the error, or with SBL_NO_EXCEPTIONS jumps into the innermost trap
+		[[noreturn]] SBL_COLD void _raise(ErrorCode ec) {
+#ifdef SBL_NO_EXCEPTIONS
+			std::longjmp(*trap, 1);
+#else
+			throw ec;
+#endif
+		}
+
+#ifdef SBL_NO_EXCEPTIONS
+		//Runs body with a trap set up for _raise, returns what body returned,
+		//or a value initialized result if an error got raised in the meantime
+		template <class Body>
+		auto _guarded(Body&& body) {
+			decltype(body()) result{};
+			std::jmp_buf buffer;
+			auto outer = trap;
+			trap = &buffer;
+			if (!setjmp(buffer))
+				result = body();
+			trap = outer;
+			return result;
+		}
+#else
+		template <class Body>
+		__forceinline auto _guarded(Body&& body) {
+			return body();
+		}
+#endif
+
 		__forceinline uint32_t& _accessRegister(uint32_t index) {
 			if (index >= registers.size()) {
 				error = Error{ ErrorCode::InvalidRegisterId, instrPtr };
 				running = false;
-				throw ErrorCode::InvalidRegisterId;
+				_raise(ErrorCode::InvalidRegisterId);
 			}
 			return registers[index];
 		}
@@ -306,7 +457,7 @@ namespace sbl::vm {
 			if (index >= fpregisters.size()) {
 				error = Error{ ErrorCode::InvalidRegisterId, instrPtr };
 				running = false;
-				throw ErrorCode::InvalidRegisterId;
+				_raise(ErrorCode::InvalidRegisterId);
 			}
 			return fpregisters[index];
 		}
@@ -364,7 +515,7 @@ namespace sbl::vm {
 				|| !_inMemory(to - memory.memory.baseAddress())) {
 				error = { ErrorCode::OutOfMemoryAccess, instrPtr };
 				running = false;
-				throw ErrorCode::OutOfMemoryAccess;
+				_raise(ErrorCode::OutOfMemoryAccess);
 			}
 
 			while (*from)
@@ -376,9 +527,11 @@ namespace sbl::vm {
 				|| !_inMemory(to - memory.memory.baseAddress())) {
 				error = { ErrorCode::OutOfMemoryAccess, instrPtr };
 				running = false;
-				throw ErrorCode::OutOfMemoryAccess;
+				_raise(ErrorCode::OutOfMemoryAccess);
 			}
 
+			_invalidateDecoded(static_cast<uint32_t>(to - memory.memory.baseAddress()), static_cast<uint32_t>(count));
+
 			while (count--)
 				*(to++) = *(from++);
 		}
@@ -461,6 +614,15 @@ namespace sbl::vm {
 				return;
 			}
 			memory.memory.setSegmentAccess(segmentId, static_cast<SegmentAccessType>(into));
+
+#ifdef SBL_AOT
+			if (into != static_cast<uint32_t>(SegmentAccessType::Executable) && _isProgramSegment(segmentId))
+				aotModule = nullptr;
+#endif
+
+			//The segment may have just lost its executable access
+			lastExecSegment = -1;
+			_refreshDecodedSegment(segmentId);
 		}
 
 		__forceinline void _getSegmentAccess(uint32_t& into, uint32_t segmentId) {
@@ -497,6 +659,489 @@ namespace sbl::vm {
 			return memAddr;
 		}
 
+		__forceinline bool _resolveOperand(OperandKind kind, uint32_t arg, uint32_t*& into) {
+			if (kind != OperandKind::Register && kind != OperandKind::Indirect)
+				return true;
+			if (arg >= registers.size())
+				return false;
+			into = &registers[arg];
+			return true;
+		}
+
+		//Decodes the instruction stored at memPtr.
+		//Invalid mnemonics and register ids are not an error here, the instruction
+		//is marked accordingly and the error is raised once it is executed
+		__forceinline void _decode(DecodedInstruction& into, const uint32_t* memPtr) {
+			into.instr = *Instruction::fromAddress(const_cast<uint32_t*>(memPtr));
+			into.runner = nullptr;
+			into.regArg1 = nullptr;
+			into.regArg2 = nullptr;
+			into.flags = DecodedInstruction::Decoded;
+			into.fusion = 0;
+			into.blockLength = 0;
+			into.blockPrivilege = 0;
+			into.blockEpoch = 0;
+#ifdef SBL_JIT
+			into.hotness = 0;
+			into.jitLength = 0;
+			into.jitCode = nullptr;
+			into.trace = 0;
+#endif
+#ifdef SBL_AOT
+			into.aot = nullptr;
+#endif
+
+			auto mnemonic = static_cast<uint32_t>(into.instr.mnemonic);
+			if (mnemonic >= Mnemonic::TotalCount)
+				return;
+
+			into.runner = runners[mnemonic / 128];
+			into.flags |= DecodedInstruction::ValidMnemonic;
+
+			auto kinds = operandKinds(into.instr.mnemonic);
+			if (_resolveOperand(kinds.first, into.instr.arg1, into.regArg1)
+				&& _resolveOperand(kinds.second, into.instr.arg2, into.regArg2))
+				into.flags |= DecodedInstruction::Resolved;
+		}
+
+		//Returns the decoded instruction at address, or nullptr if the address does not
+		//lie in a decoded segment and the instruction has to be read from memory instead
+		__forceinline DecodedInstruction* _fetchDecoded(uint32_t address) {
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			auto segId = address / segmentSize;
+			auto offset = address % segmentSize;
+
+			//Instructions reaching into the following segment are never decoded,
+			//the following segment does not have to be decoded itself
+			if (segId >= decodedSegments.size() || !decodedSegments[segId].enabled || offset > segmentSize - 3)
+				return nullptr;
+
+			auto& entry = decodedSegments[segId].entries[offset];
+			if (!(entry.flags & DecodedInstruction::FusionChecked)) {
+				if (!(entry.flags & DecodedInstruction::Decoded))
+					_decode(entry, &memory.memory._getNocheck(address));
+				//Verified programs run decoded instructions without checking them,
+				//whatever would fail the checks has to go through the checked path
+				if (verification.verified() && !_isRunnable(entry))
+					return nullptr;
+				_fuse(entry, address);
+			}
+
+			return &entry;
+		}
+
+		//Whether the decoded instruction passes the checks the verified profiles skip
+		__forceinline static bool _isRunnable(const DecodedInstruction& entry) {
+			constexpr auto checked = DecodedInstruction::ValidMnemonic | DecodedInstruction::Resolved;
+			return (entry.flags & checked) == checked;
+		}
+
+		//Leaves the decoded instructions that are not runnable to the checked path,
+		//once the program turns out to be verified after its segments got decoded
+		void _dropUnrunnable() {
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			for (auto& segment : decodedSegments) {
+				if (!segment.enabled)
+					continue;
+				for (uint32_t offset = 0; offset < segmentSize; ++offset) {
+					if (!_isRunnable(segment.entries[offset]))
+						segment.entries[offset].flags &= ~DecodedInstruction::FusionChecked;
+				}
+			}
+		}
+
+		//Finds the fusion pattern starting at the decoded instruction entry, stored at address.
+		//The other instructions of the pattern are decoded as needed, and have to lie
+		//in the same segment
+		__forceinline void _fuse(DecodedInstruction& entry, uint32_t address) {
+			entry.flags |= DecodedInstruction::FusionChecked;
+			entry.fusion = 0;
+
+#ifndef SBL_NO_FUSION
+			if (!(entry.flags & DecodedInstruction::Resolved))
+				return;
+
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			auto offset = address % segmentSize;
+
+			for (uint32_t i = 0; i < FusionPatternCount; ++i) {
+				auto& pattern = fusionPatterns[i];
+				if (offset + pattern.length * 3 > segmentSize)
+					continue;
+
+				bool matches = true;
+				for (uint32_t k = 0; k < pattern.length && matches; ++k) {
+					auto& member = (&entry)[k * 3];
+					if (!(member.flags & DecodedInstruction::Decoded))
+						_decode(member, &memory.memory._getNocheck(address + k * 3));
+					matches = member.instr.mnemonic == pattern.mnemonics[k]
+								&& (member.flags & DecodedInstruction::Resolved);
+				}
+
+				if (matches) {
+					entry.fusion = static_cast<uint8_t>(i + 1);
+					return;
+				}
+			}
+#endif
+		}
+
+		//Enables or disables the decoded instructions of a segment according to
+		//its current access rights. Enabling decodes the segment ahead of time at the
+		//alignment of the entry point, instructions at other offsets are decoded on demand
+		void _refreshDecodedSegment(uint32_t segmentId) {
+			if (segmentId >= decodedSegments.size())
+				return;
+
+#ifdef SBL_JIT
+			for (auto& trace : traces)
+				trace.code = nullptr;
+			traceRecording = false;
+#endif
+
+			auto& segment = decodedSegments[segmentId];
+			if (memory.memory.getSegmentAccess(segmentId) != SegmentAccessType::Executable) {
+				segment.enabled = false;
+				return;
+			}
+
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			if (!segment.entries)
+				segment.entries = std::make_unique<DecodedInstruction[]>(segmentSize);
+			else
+				std::fill_n(segment.entries.get(), segmentSize, DecodedInstruction{});
+
+			auto base = segmentId * segmentSize;
+			auto first = (decodeAlignment + 3 - base % 3) % 3;
+			for (auto offset = first; offset + 3 <= segmentSize; offset += 3)
+				_decode(segment.entries[offset], &memory.memory._getNocheck(base + offset));
+			for (auto offset = first; offset + 3 <= segmentSize; offset += 3) {
+				if (verification.verified() && !_isRunnable(segment.entries[offset]))
+					continue;
+				_fuse(segment.entries[offset], base + offset);
+			}
+#ifdef SBL_AOT
+			_attachAot(segmentId);
+#endif
+
+#ifndef SBL_NO_BASIC_BLOCKS
+			//Each block ends at the first instruction that cannot continue it,
+			//so walking backwards gives the length of every block in one pass
+			uint16_t following = 0;
+			for (auto i = (segmentSize - first) / 3; i-- > 0;) {
+				auto& entry = segment.entries[first + i * 3];
+				if (!(entry.flags & DecodedInstruction::Resolved))
+					following = 0;
+				else
+					following = _continuesBlock(entry) ? static_cast<uint16_t>(following + 1) : 1;
+				entry.blockLength = following;
+			}
+#endif
+
+			segment.enabled = true;
+		}
+
+		//Decodes again the decoded segments overlapping count words starting at address.
+		//Neither instructions, fused groups nor basic blocks cross segments, so nothing
+		//outside of these segments can be affected by the write.
+		//Disabled segments are decoded from scratch once they get enabled
+		__forceinline void _invalidateDecoded(uint32_t address, uint32_t count) {
+			if (!count)
+				return;
+
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			for (auto segId = address / segmentSize; segId <= (address + count - 1) / segmentSize; ++segId) {
+				if (segId < decodedSegments.size() && decodedSegments[segId].enabled) {
+#ifdef SBL_AOT
+					if (_isProgramSegment(segId))
+						aotModule = nullptr;
+#endif
+					_refreshDecodedSegment(segId);
+				}
+			}
+		}
+
+#ifdef SBL_AOT
+		__forceinline bool _isProgramSegment(uint32_t segmentId) const {
+			auto address = static_cast<size_t>(segmentId) * memory.memory.getSegmentSize();
+			return address >= memory.programBase && address < memory.dynamicBase;
+		}
+
+		//Points the decoded entry points of the segment to the compiled regions of aotModule
+		void _attachAot(uint32_t segmentId) {
+			if (!aotModule)
+				return;
+
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			auto base = static_cast<uint64_t>(segmentId) * segmentSize;
+			auto end = aotModule->regions + aotModule->regionCount;
+			auto region = std::lower_bound(aotModule->regions, end, base, [](const AotRegion& region, uint64_t address) {
+				return region.address < address;
+			});
+
+			auto& segment = decodedSegments[segmentId];
+			for (; region != end && region->address < base + segmentSize; ++region) {
+				auto offset = static_cast<uint32_t>(region->address - base);
+				if (offset <= segmentSize - 3 && (segment.entries[offset].flags & DecodedInstruction::Decoded))
+					segment.entries[offset].aot = region->function;
+			}
+		}
+
+		//Runs the compiled region the decoded instruction is an entry point of.
+		//The instruction has been counted and validated already
+		__forceinline bool _runAot(DecodedInstruction* decoded) {
+			AotFrame frame{ *this };
+			return decoded->aot(frame);
+		}
+#endif
+
+		//Same conditions as the jumps in Basic.cpp, 0 if the mnemonic is not a conditional jump
+		static constexpr uint32_t _jumpCondition(Mnemonic m) {
+			switch (m) {
+				case Mnemonic::Jb_A:	case Mnemonic::Jnle_A:
+				case Mnemonic::RJb_A:	case Mnemonic::RJnle_A:
+					return TestBigger;
+				case Mnemonic::Jnb_A:	case Mnemonic::Jle_A:
+				case Mnemonic::RJnb_A:	case Mnemonic::RJle_A:
+					return TestSmallerEqual;
+				case Mnemonic::Jbe_A:	case Mnemonic::Jnl_A:
+				case Mnemonic::RJbe_A:	case Mnemonic::RJnl_A:
+					return TestBiggerEqual;
+				case Mnemonic::Jnbe_A:	case Mnemonic::Jl_A:
+				case Mnemonic::RJnbe_A:	case Mnemonic::RJl_A:
+					return TestSmaller;
+				case Mnemonic::Jz_A:	case Mnemonic::Je_A:
+				case Mnemonic::RJz_A:	case Mnemonic::RJe_A:
+					return TestEqual;
+				case Mnemonic::Jnz_A:	case Mnemonic::Jne_A:
+				case Mnemonic::RJnz_A:	case Mnemonic::RJne_A:
+					return TestUnequal;
+				default:
+					break;
+			}
+			return 0;
+		}
+
+		//Whether a basic block may continue past the decoded instruction.
+		//Only instructions that never transfer control, never change anything the checks
+		//done at the start of a block depend on(privileges, interrupts, access rights,
+		//instruction count) and that raise their errors through _raise can do so.
+		//Instructions writing to a register could move instrPtr, so naming it ends the block too
+		static constexpr bool _continuesBlock(Mnemonic m) {
+			auto in = [m](Mnemonic first, Mnemonic last) {
+				return m >= first && m <= last;
+			};
+
+			return m == Mnemonic::Nop
+				|| in(Mnemonic::Push_R, Mnemonic::Push_V)
+				|| in(Mnemonic::Pop_R, Mnemonic::Pop_I)
+				|| in(Mnemonic::Inc_R, Mnemonic::Dec_I)
+				|| in(Mnemonic::Read_R, Mnemonic::Printstr_I)
+				|| in(Mnemonic::Time_R, Mnemonic::Time_I)
+				|| in(Mnemonic::Time64_A, Mnemonic::Time64_I)
+				|| in(Mnemonic::Mov_R_R, Mnemonic::Loadload_I_I)
+				|| in(Mnemonic::GetNtvId_R_A, Mnemonic::ClrCb)
+				|| in(Mnemonic::IsExtEnabled_R_R, Mnemonic::IsExtEnabled_I_V)
+				|| in(Mnemonic::Add_R_R, Mnemonic::Not_I)			//Arithmetic and Logical
+				|| in(Mnemonic::Test_R_R, Mnemonic::GetDynSize_I_V)	//Rest of Logical and Allocation
+				|| in(Mnemonic::FpMov_R_R, Mnemonic::MvNanFlag_I);
+		}
+
+		__forceinline bool _continuesBlock(const DecodedInstruction& entry) {
+			constexpr uint32_t instrPtrId = 62;
+
+			if (!_continuesBlock(entry.instr.mnemonic))
+				return false;
+
+			return entry.regArg1 != &registers[instrPtrId] && entry.regArg2 != &registers[instrPtrId];
+		}
+
+		//Whether length instructions of the basic block starting at decoded can run
+		//without the checks of the instructions, that is none of them would trigger
+		//the instruction count interrupt and the whole block passes the privilege check.
+		//The first instruction of the block has been counted and validated already
+		template <class Profile = FullProfile>
+		__forceinline bool _canRunBlock(DecodedInstruction* decoded, uint32_t length) {
+			if (Profile::interrupts && nextInstrCountInterrupt && instrCount + length - 1 > nextInstrCountInterrupt)
+				return false;
+
+			if (!Profile::privileges)
+				return true;
+
+			if (decoded->blockEpoch != privilegeEpoch) {
+				uint8_t required = 0;
+				for (uint32_t k = 0; k < decoded->blockLength; ++k)
+					required = std::max(required, instrPrivileges[static_cast<uint32_t>(decoded[k * 3].instr.mnemonic)]);
+				decoded->blockPrivilege = required;
+				decoded->blockEpoch = privilegeEpoch;
+			}
+
+			return decoded->blockPrivilege <= privilegeLevel;
+		}
+
+		//Starts a basic block at decoded, if there is one and it can run without
+		//the checks of its instructions. Counts the whole block ahead of time
+		template <class Profile = FullProfile>
+		__forceinline void _startBlock(DecodedInstruction* decoded) {
+			uint32_t length = decoded->blockLength;
+			if (length < 2 || !_canRunBlock<Profile>(decoded, length))
+				return;
+
+			instrCount += length - 1;
+			precharged = length - 1;
+			blockNext = decoded + 3;
+		}
+
+		//Moves to the next instruction of the running basic block
+		__forceinline DecodedInstruction* _nextInBlock() {
+			auto decoded = blockNext;
+			--precharged;
+			blockNext = decoded + 3;
+			instrPtr += 3;
+			lastExecuted = &decoded->instr;
+			return decoded;
+		}
+
+		__forceinline void _dropPrecharged() {
+			instrCount -= precharged;
+			precharged = 0;
+		}
+
+#ifdef SBL_JIT
+		bool _emitInstruction(X64Emitter& emitter, const DecodedInstruction& entry, uint32_t segmentShift,
+								bool hoisted, std::vector<X64Emitter::Fixup>& failed);
+
+		//Translates the basic block starting at decoded, see extensions/Jit.cpp
+		bool _compileBlock(DecodedInstruction* decoded);
+		//Translates the recorded loop body, see extensions/Jit.cpp
+		bool _compileTrace();
+
+		//Starts recording the loop body starting at decoded, if decoded is the head of
+		//the running loop. The recording ends once the execution gets back to the head
+		__forceinline void _startTrace(DecodedInstruction* decoded) {
+			auto address = instrPtr - 3;
+			if (address != loopPtr || traceRecording || (decoded->flags & DecodedInstruction::TraceChecked))
+				return;
+
+			decoded->flags |= DecodedInstruction::TraceChecked;
+			traceRecord.clear();
+			traceRecord.push_back({ decoded, address });
+			traceRecording = true;
+		}
+
+		__forceinline void _recordTrace(DecodedInstruction* decoded) {
+			if (decoded != traceRecord.front().first) {
+				traceRecord.push_back({ decoded, instrPtr - 3 });
+				//Left the loop, or the body is too long anyway
+				if (traceRecord.size() > MaxTraceLength)
+					traceRecording = false;
+				return;
+			}
+
+			traceRecording = false;
+			_compileTrace();
+		}
+
+		//Runs the trace of the loop starting at decoded. Returns false if the trace did not run,
+		//which is also the case when decoded is not the head of the running loop.
+		//The first instruction of the loop has been counted and validated already
+		template <class Profile = FullProfile>
+		__forceinline bool _runTrace(DecodedInstruction* decoded) {
+			auto& trace = traces[decoded->trace - 1];
+			if (!trace.code || instrPtr - 3 != loopPtr)
+				return false;
+
+			if (Profile::privileges) {
+				if (trace.epoch != privilegeEpoch) {
+					uint8_t required = 0;
+					for (auto instr : trace.instructions)
+						required = std::max(required, instrPrivileges[static_cast<uint32_t>(instr->mnemonic)]);
+					trace.privilege = required;
+					trace.epoch = privilegeEpoch;
+				}
+
+				if (trace.privilege > privilegeLevel)
+					return false;
+			}
+
+			//Instructions that can be counted before the instruction count interrupt
+			uint64_t allowed = Profile::interrupts && nextInstrCountInterrupt ? nextInstrCountInterrupt - instrCount + 1 : UINT64_MAX;
+			uint64_t length = trace.instructions.size();
+
+			JitContext context{
+				registers.data(),
+				memory.memory.baseAddress(),
+				reinterpret_cast<const uint8_t*>(memory.memory.segmentInformation()),
+				memory.memory.getSegmentCount(),
+				&controlByte,
+				0,
+				allowed / length,
+			};
+
+			auto next = instrPtr;
+			uint64_t executed = trace.code(&context);
+			executed += context.iterations * length;
+			if (!executed) {
+				instrPtr = next;
+				return false;
+			}
+
+			instrCount += executed - 1;
+			lastExecuted = trace.instructions[(executed - 1) % length];
+			return true;
+		}
+
+		//Runs the trace of the loop, or the compiled code of the basic block starting
+		//at decoded, compiling the block first once it gets hot. Hot blocks starting a loop
+		//start recording the trace of the loop too. Returns false if no code ran,
+		//and the instruction has to be run by the interpreter instead.
+		//The first instruction of the block has been counted and validated already
+		template <class Profile = FullProfile>
+		__forceinline bool _runJit(DecodedInstruction* decoded) {
+			if (traceRecording)
+				_recordTrace(decoded);
+
+			if (decoded->trace && _runTrace<Profile>(decoded))
+				return true;
+
+			if (decoded->blockLength < 2)
+				return false;
+
+			if (!decoded->jitCode) {
+				if ((decoded->flags & DecodedInstruction::JitChecked) || ++decoded->hotness < JitThreshold)
+					return false;
+
+				decoded->flags |= DecodedInstruction::JitChecked;
+				_startTrace(decoded);
+				if (!_compileBlock(decoded))
+					return false;
+			}
+
+			if (!_canRunBlock<Profile>(decoded, decoded->jitLength))
+				return false;
+
+			JitContext context{
+				registers.data(),
+				memory.memory.baseAddress(),
+				reinterpret_cast<const uint8_t*>(memory.memory.segmentInformation()),
+				memory.memory.getSegmentCount(),
+				&controlByte,
+			};
+
+			auto next = instrPtr;
+			uint32_t executed = decoded->jitCode(&context);
+			//Left through the side exit of the first instruction
+			if (!executed) {
+				instrPtr = next;
+				return false;
+			}
+
+			instrCount += executed - 1;
+			lastExecuted = &decoded[(executed - 1) * 3].instr;
+			return true;
+		}
+#endif
+
 		//Try read from various types, according to the rules
 		//such as no out of bounds index for register, or no
 		//read from non-readable segment
@@ -524,7 +1169,7 @@ namespace sbl::vm {
 				}
 				error = { ec, instrPtr };
 				running = false;
-				throw ec;
+				_raise(ec);
 			}
 			return *ptr;
 		}
@@ -533,6 +1178,14 @@ namespace sbl::vm {
 			return _tryRead(Address{ _tryRead(Register{ indr.regId }) });
 		}
 
+		__forceinline uint32_t& _tryRead(ResolvedRegister reg) {
+			return *reg.reg;
+		}
+
+		__forceinline uint32_t& _tryRead(ResolvedIndirect indr) {
+			return _tryRead(Address{ *indr.reg });
+		}
+
 		//Try read from dynamic memory range
 		__forceinline uint32_t& _tryReadDynamic(uint32_t value, uint32_t offset) {
 			return dynamicHandler.getDynamic(this, value, offset);
@@ -564,6 +1217,14 @@ namespace sbl::vm {
 			return memory.memory._getNocheck(_tryRead(Register{ indr.regId }));
 		}
 
+		__forceinline uint32_t& _forceRead(ResolvedRegister reg) {
+			return *reg.reg;
+		}
+
+		__forceinline uint32_t& _forceRead(ResolvedIndirect indr) {
+			return memory.memory._getNocheck(*indr.reg);
+		}
+
 		//Same as _forceRead, but does the Deref instead
 		__forceinline uint32_t& _forceReadDeref(Register reg) {
 			return _accessRegister(reg.regId);
@@ -608,6 +1269,14 @@ namespace sbl::vm {
 			return _tryRead(indr);
 		}
 
+		__forceinline uint32_t& _tryReadDeref(ResolvedRegister reg) {
+			return *reg.reg;
+		}
+
+		__forceinline uint32_t& _tryReadDeref(ResolvedIndirect indr) {
+			return _tryRead(indr);
+		}
+
 		//Helpers for Laddr instruction
 		__forceinline uint32_t _tryReadAddr(Address addr) {
 			return addr.addr;
@@ -617,6 +1286,10 @@ namespace sbl::vm {
 			return _tryRead(Register{ indr.regId });
 		}
 
+		__forceinline uint32_t _tryReadAddr(ResolvedIndirect indr) {
+			return *indr.reg;
+		}
+
 		//Try to write into a destination according to rules set by its type
 		//such as no out of bounds register index or no write to non-writable segment
 		__forceinline void _tryWrite(Value dest, uint32_t value) {
@@ -643,7 +1316,7 @@ namespace sbl::vm {
 				}
 				error = { ec, instrPtr };
 				running = false;
-				throw ec;
+				_raise(ec);
 			}
 			*ptr = value;
 		}
@@ -652,6 +1325,14 @@ namespace sbl::vm {
 			_tryWrite(Address{ _tryRead(Register{ dest.regId }) }, value);
 		}
 
+		__forceinline void _tryWrite(ResolvedRegister dest, uint32_t value) {
+			*dest.reg = value;
+		}
+
+		__forceinline void _tryWrite(ResolvedIndirect dest, uint32_t value) {
+			_tryWrite(Address{ *dest.reg }, value);
+		}
+
 		//Same as with _forceRead, but for writing
 		__forceinline void _forceWrite(Register dest, uint32_t value) {
 			_accessRegister(dest.regId) = value;
@@ -669,6 +1350,14 @@ namespace sbl::vm {
 			memory.memory._getNocheck(_tryRead(Register{ dest.regId })) = value;
 		}
 
+		__forceinline void _forceWrite(ResolvedRegister dest, uint32_t value) {
+			*dest.reg = value;
+		}
+
+		__forceinline void _forceWrite(ResolvedIndirect dest, uint32_t value) {
+			memory.memory._getNocheck(*dest.reg) = value;
+		}
+
 		//Try to add into a memory according to the rules of its types
 		//such as no out of bounds register id or no try to read/write from
 		//memory segment that disallows either of these operations
@@ -696,6 +1385,14 @@ namespace sbl::vm {
 			_tryAdd(Address{ _tryRead(Register{ dest.regId }) }, value);
 		}
 
+		__forceinline void _tryAdd(ResolvedRegister dest, uint32_t value) {
+			*dest.reg += value;
+		}
+
+		__forceinline void _tryAdd(ResolvedIndirect dest, uint32_t value) {
+			_tryAdd(Address{ *dest.reg }, value);
+		}
+
 		//Helpers for LoadLoad and Hotpatch
 		__forceinline Address _tryAdd(Address left, Address right) {
 			return Address{ _tryReadDeref(left) + _tryReadDeref(right) };
@@ -713,6 +1410,10 @@ namespace sbl::vm {
 			return Address{ _tryReadDeref(left) + _tryReadDeref(right) };
 		}
 
+		__forceinline Address _tryAdd(Address left, ResolvedIndirect right) {
+			return Address{ _tryReadDeref(left) + _tryReadDeref(right) };
+		}
+
 		//For operations that read AND write to the same operand(most of them)
 		__forceinline bool _isReadWrite(Address addr) {
 			return memory.memory.tryAccess(addr.addr, SegmentAccessType::Readable | SegmentAccessType::Writable);
@@ -722,6 +1423,10 @@ namespace sbl::vm {
 			return _isReadWrite(Address{ _tryRead(Register{ indr.regId }) });
 		}
 
+		__forceinline bool _isReadWrite(ResolvedIndirect indr) {
+			return _isReadWrite(Address{ *indr.reg });
+		}
+
 		void _assertReadWrite(Register r) {}
 		void _assertReadWrite(FpRegister r) {}
 		void _assertReadWrite(Address addr) {
@@ -738,6 +1443,14 @@ namespace sbl::vm {
 				_tryWrite(indr, 0);
 			}
 		}
+		void _assertReadWrite(ResolvedRegister r) {}
+		void _assertReadWrite(ResolvedIndirect indr) {
+			if (!_isReadWrite(indr)) {
+				//One of these two will for sure throw an error before completing
+				_tryRead(indr);
+				_tryWrite(indr, 0);
+			}
+		}
 
 		bool _executeInterrupt() {
 			if (!running)	return false;
@@ -894,6 +1607,7 @@ namespace sbl::vm {
 				}*/
 			}
 
+			_dropPrecharged();
 			instrPtr = oldInstr;
 			return running;
 		}
@@ -910,12 +1624,15 @@ namespace sbl::vm {
 			return b;
 		}
 
-		bool _execute() {
+		//Counts the instruction and services the instruction count interrupt.
+		//Returns false if the execution should not continue
+		template <class Profile = FullProfile>
+		__forceinline bool _countInstruction() {
 			if (!running)	return false;
 
 			++instrCount;
 			
-			if (nextInstrCountInterrupt && instrCount > nextInstrCountInterrupt) {
+			if (Profile::interrupts && nextInstrCountInterrupt && instrCount > nextInstrCountInterrupt) {
 				int b = _runInterruptCode(static_cast<uint32_t>(InterruptType::InstrCount));
 				nextInstrCountInterrupt = 0;
 				if (!b) {
@@ -927,27 +1644,137 @@ namespace sbl::vm {
 					return false;
 			}
 
+			return true;
+		}
+
+		//Validates the mnemonic and the privilege required to run it
+		template <class Profile = FullProfile>
+		__forceinline bool _canPerform(Instruction* nextInstr) {
+			if (static_cast<uint32_t>(nextInstr->mnemonic) >= Mnemonic::TotalCount) {
+				_onInvalidDecode();
+				return false;
+			}
+
+			return !Profile::privileges || _testPrivilege(instrPrivileges[static_cast<uint32_t>(nextInstr->mnemonic)], nextInstr);
+		}
+
+		template <class Profile = FullProfile>
+		bool _execute() {
+			//Inside of a basic block, everything has been checked for the whole block already
+			if (precharged)
+				return _performStep<Profile>(_nextInBlock());
+
+			if (!_countInstruction<Profile>())
+				return false;
+
+			return _executeCounted<Profile>();
+		}
+
+		//Runs the instruction at instrPtr, which has been counted already
+		template <class Profile = FullProfile>
+		__forceinline bool _executeCounted() {
+			if (auto decoded = _fetchDecoded(instrPtr)) {
+				instrPtr += 3;
+				lastExecuted = &decoded->instr;
+
+				return _performDecoded<Profile>(decoded);
+			}
+
+			//Not in a decoded segment, decode straight from the memory
 			auto memPtr = _checkExecutable(instrPtr);
 			if (!memPtr)
 				return false;
 
-			// Literally the entire decode:
 			auto nextInstr = Instruction::fromAddress(memPtr);
 			instrPtr += 3;
 			lastExecuted = nextInstr;
 
-			return _perform(nextInstr);
+			return _perform<Profile>(nextInstr);
 		}
 
-		bool _perform(Instruction* nextInstr) {
-			auto chunkId = static_cast<uint32_t>(nextInstr->mnemonic) / 128;
-
-			if (chunkId >= runners.size()) {
+		template <class Profile = FullProfile>
+		__forceinline bool _canPerformDecoded(DecodedInstruction* decoded) {
+			if (!Profile::verified && !(decoded->flags & DecodedInstruction::ValidMnemonic)) {
 				_onInvalidDecode();
 				return false;
 			}
 
-			if (!_testPrivilege(instrPrivileges[static_cast<uint32_t>(nextInstr->mnemonic)], nextInstr)) {
+			return !Profile::privileges || _testPrivilege(instrPrivileges[static_cast<uint32_t>(decoded->instr.mnemonic)], &decoded->instr);
+		}
+
+		//Whether the group of instructions fused from decoded can run as a whole.
+		//The first instruction of the group has been counted and validated already
+		template <class Profile = FullProfile>
+		__forceinline bool _canFuse(const DecodedInstruction* decoded) {
+			auto& pattern = fusionPatterns[decoded->fusion - 1];
+			if (Profile::interrupts && nextInstrCountInterrupt && instrCount + pattern.length - 1 > nextInstrCountInterrupt)
+				return false;
+
+			if (!Profile::privileges)
+				return true;
+
+			for (uint32_t k = 1; k < pattern.length; ++k) {
+				if (instrPrivileges[static_cast<uint32_t>(decoded[k * 3].instr.mnemonic)] > privilegeLevel)
+					return false;
+			}
+			return true;
+		}
+
+		//Whether the fused group starting at decoded should run fused. Inside of a basic block
+		//the group has to fit into the rest of the block, which has been checked as a whole,
+		//outside of one the group gets checked and counted ahead of time on its own
+		template <class Profile = FullProfile>
+		__forceinline bool _shouldFuse(DecodedInstruction* decoded) {
+			uint32_t length = fusionPatterns[decoded->fusion - 1].length;
+			if (precharged)
+				return length - 1 <= precharged;
+
+			if (!_canFuse<Profile>(decoded))
+				return false;
+
+			instrCount += length - 1;
+			precharged = length - 1;
+			return true;
+		}
+
+		//Moves to the next instruction of a fused group, the same way _nextInBlock does
+		__forceinline void _enterFused(DecodedInstruction* member) {
+			--precharged;
+			blockNext = member + 3;
+			instrPtr += 3;
+			lastExecuted = &member->instr;
+		}
+
+		template <class Profile = FullProfile>
+		__forceinline bool _performStep(DecodedInstruction* decoded) {
+			if (decoded->fusion && _shouldFuse<Profile>(decoded))
+				return _performFused(decoded);
+
+			return (this->*decoded->runner)(&decoded->instr);
+		}
+
+		template <class Profile = FullProfile>
+		bool _performDecoded(DecodedInstruction* decoded) {
+			if (!_canPerformDecoded<Profile>(decoded)) {
+				return false;
+			}
+
+#ifdef SBL_AOT
+			if (decoded->aot && aotModule)
+				return _runAot(decoded);
+#endif
+#ifdef SBL_JIT
+			if (_runJit<Profile>(decoded))
+				return true;
+#endif
+
+			_startBlock<Profile>(decoded);
+			return _performStep<Profile>(decoded);
+		}
+
+		template <class Profile = FullProfile>
+		bool _perform(Instruction* nextInstr) {
+			if (!_canPerform<Profile>(nextInstr)) {
 				return false;
 			}
 
@@ -955,7 +1782,7 @@ namespace sbl::vm {
 				Categories are rounded to 128 sized chunks
 				Therefore we go retreive the id of the chunk
 			*/
-			return (this->*runners[chunkId])(nextInstr);
+			return (this->*runners[static_cast<uint32_t>(nextInstr->mnemonic) / 128])(nextInstr);
 		}
 
 		void _printError() {
@@ -973,6 +1800,8 @@ namespace sbl::vm {
 			nextInstrCountInterrupt = 0;
 			interrupts.fill({});
 			instrPrivileges.fill(0);
+			++privilegeEpoch;
+			precharged = 0;
 			for (size_t i = 240; i < interrupts.size(); ++i)
 				interrupts[i].privilegeRequired = 255;
 
@@ -1004,7 +1833,45 @@ namespace sbl::vm {
 		bool _performPrivilege(Instruction* instr);
 		bool _performFloat(Instruction* instr);
 
-		using InstrRunner = bool(VM::*)(Instruction*);
+		bool _performFused(DecodedInstruction* first);
+
+#ifdef SBL_DIRECT_THREADED
+		template <class Profile>
+		void _loopThreaded();
+#endif
+
+#ifdef SBL_TAIL_CALL
+		//Handler of the tail call engine, see extensions/TailCall.cpp
+		using TailHandler = void (*)(VM* vm, DecodedInstruction* decoded);
+
+		//Next instruction to run and the handler running it, handler is nullptr when the loop ends
+		struct TailStep {
+			TailHandler handler;
+			DecodedInstruction* decoded;
+		};
+
+		template <class Profile>
+		static const std::array<TailHandler, static_cast<uint32_t>(Mnemonic::TotalCount)> tailHandlers;
+
+		template <class Profile>
+		TailStep _tailFetch();
+
+		//Runs the instruction and fetches the next one
+		template <class Profile, Mnemonic M>
+		TailStep _tailRun(DecodedInstruction* decoded);
+
+		template <class Profile, Mnemonic M>
+		static void _tailHandler(VM* vm, DecodedInstruction* decoded);
+
+		template <class Profile>
+		static void _tailFused(VM* vm, DecodedInstruction* decoded);
+
+		template <class Profile>
+		static void _tailFallback(VM* vm, DecodedInstruction* decoded);
+
+		template <class Profile>
+		void _loopTail();
+#endif
 
 		static constexpr std::array<InstrRunner, 
 							static_cast<uint32_t>(Mnemonic::TotalCount) / 128> runners = {
@@ -1020,15 +1887,62 @@ namespace sbl::vm {
 			&_performFloat,			/* FloatOperations,		 */
 		};
 
+		template <class Profile>
+		void _loopWith() {
+#ifdef SBL_DIRECT_THREADED
+			_loopThreaded<Profile>();
+#elif defined(SBL_TAIL_CALL)
+			_loopTail<Profile>();
+#else
+			while (_execute<Profile>()) {
+			}
+#endif
+		}
+
+		//Runs the loop of the profile the program has been loaded with
+		SBL_NOINLINE void _loopProfile() {
+			switch (profileFeatures | (verification.verified() ? VerifiedProfile : 0)) {
+				case MinimalProfile::features:
+					_loopWith<MinimalProfile>();
+					break;
+				case NoPrivilegeProfile::features:
+					_loopWith<NoPrivilegeProfile>();
+					break;
+				case NoInterruptProfile::features:
+					_loopWith<NoInterruptProfile>();
+					break;
+				case FullProfile::features:
+					_loopWith<FullProfile>();
+					break;
+				case VerifiedOf<MinimalProfile>::features:
+					_loopWith<VerifiedOf<MinimalProfile>>();
+					break;
+				case VerifiedOf<NoPrivilegeProfile>::features:
+					_loopWith<VerifiedOf<NoPrivilegeProfile>>();
+					break;
+				case VerifiedOf<NoInterruptProfile>::features:
+					_loopWith<VerifiedOf<NoInterruptProfile>>();
+					break;
+				case VerifiedOf<FullProfile>::features:
+					_loopWith<VerifiedOf<FullProfile>>();
+					break;
+			}
+		}
+
 		void _loop() {
+#ifdef SBL_NO_EXCEPTIONS
+			_guarded([this] { _loopProfile(); return true; });
+#else
 			try {	
-				while (_execute()) {
-				}
+				_loopProfile();
 			} catch (ErrorCode&) {
 			} catch (...) {
 				error = { ErrorCode::UnknownError, instrPtr };
 				running = false;
 			}
+#endif
+
+			_dropPrecharged();
 		}
 
 		bool _initMemory(const std::vector<uint32_t>& stream) {
@@ -1055,9 +1969,82 @@ namespace sbl::vm {
 									&stream[sizeof(CompiledHeader) / sizeof(uint32_t)]))
 				return false;
 			instrPtr = header.startAddress + (uint32_t)memory.programBase;
+
+			decodeAlignment = instrPtr % 3;
+			verification = {};
+			decodedSegments.clear();
+#ifdef SBL_JIT
+			jitArena.reset();
+			traces.clear();
+			traceRecording = false;
+#endif
+#ifdef SBL_AOT
+			aotModule = findAotModule(stream);
+#endif
+			decodedSegments.resize(memory.memory.getSegmentCount());
+			for (uint32_t i = 0; i < decodedSegments.size(); ++i)
+				_refreshDecodedSegment(i);
+
+			profileFeatures = header.requiredFeatures();
+			if (!_checkProfile(static_cast<uint32_t>(memory.programBase), header.programSize))
+				return false;
+
+			verification = _verify(static_cast<uint32_t>(memory.programBase), header.programSize);
+			if (verification.verified())
+				_dropUnrunnable();
+
 			return true;
 		}
 
+		//Verifies the program image, see extensions/Verifier.cpp
+		Verification _verify(uint32_t programBase, uint32_t programSize);
+
+		//Rejects the program if any instruction of its program image belongs
+		//to an extension the profile picked for it leaves out, see Profile.hpp
+		bool _checkProfile(uint32_t programBase, uint32_t programSize) {
+			if (profileFeatures == AllFeatures)
+				return true;
+
+			auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+			for (uint32_t address = programBase + decodeAlignment; address + 3 <= programBase + programSize; address += 3) {
+				auto& segment = decodedSegments[address / segmentSize];
+				if (!segment.enabled)
+					continue;
+
+				auto& entry = segment.entries[address % segmentSize];
+				if (!(entry.flags & DecodedInstruction::ValidMnemonic))
+					continue;
+
+				if (!_isProfileInstruction(entry.instr.mnemonic)) {
+					error = { ErrorCode::DisabledExtensionUse, address };
+					running = false;
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		//Whether the instruction belongs to an extension of the running profile
+		__forceinline bool _isProfileInstruction(Mnemonic mnemonic) const {
+			if (mnemonic >= Mnemonic::Raise_R && mnemonic < Mnemonic::GetPrivlg_R)
+				return profileFeatures & FeatureInterrupts;
+			if (mnemonic >= Mnemonic::GetPrivlg_R && mnemonic < Mnemonic::FpMov_R_R)
+				return profileFeatures & FeaturePrivileges;
+			return true;
+		}
+
+		//Raises DisabledExtensionUse if the instruction is not part of the running profile.
+		//Only reachable by code written or made executable after the program got loaded
+		__forceinline bool _testProfile(Instruction* instr) {
+			if (_isProfileInstruction(instr->mnemonic))
+				return true;
+
+			error = { ErrorCode::DisabledExtensionUse, instrPtr };
+			running = false;
+			return false;
+		}
+
 	public:
 		VM() : innerState(*this) {}
 
@@ -1145,6 +2132,11 @@ namespace sbl::vm {
 			namesSorted = true;
 		}
 
+		//Result of verifying the program loaded by the last run, see Verifier.hpp
+		const Verification& getVerification() const {
+			return verification;
+		}
+
 		Error getError() const {
 			return error;
 		}
@@ -1241,23 +2233,115 @@ namespace sbl::vm {
 	}
 
 	inline bool vm::State::runFunction(uint32_t address) {
-		return vm->_executeFunc(address);
+		return vm->_guarded([&] { return vm->_executeFunc(address); });
 	}
 
 	inline bool vm::State::runFunction(uint32_t address, uint8_t privilege) {
 		Instruction* _executor = nullptr;
-		return vm->_executeFunc(address, privilege, _executor);
+		return vm->_guarded([&] { return vm->_executeFunc(address, privilege, _executor); });
 	}
 
 	inline bool vm::State::raiseInterrupt(uint8_t code) {
-		return vm->_runInterruptCode(code);
+		return vm->_guarded([&] { return vm->_runInterruptCode(code); });
+	}
+
+#ifdef SBL_AOT
+	inline AotFrame::AotFrame(VM& vm) : vm(vm), r(vm.registers.data()), depth(vm.callDepth)
+	{
+	}
+
+	inline uint32_t AotFrame::start() const {
+		return vm.instrPtr - 3;
+	}
+
+	inline uint32_t AotFrame::next() const {
+		return vm.instrPtr;
+	}
+
+	inline bool AotFrame::resume() const {
+		return proceed && vm.callDepth == depth;
+	}
+
+	inline bool AotFrame::enter(uint32_t address) {
+		vm.instrPtr = address;
+		if (!vm.aotModule)
+			return false;
+
+		if (!vm._countInstruction()) {
+			proceed = false;
+			return false;
+		}
+
+		//The interrupt run by the count may have changed the code
+		auto decoded = vm.aotModule ? vm._fetchDecoded(address) : nullptr;
+		if (!decoded) {
+			proceed = vm._executeCounted();
+			return false;
+		}
+
+		vm.instrPtr += 3;
+		vm.lastExecuted = &decoded->instr;
+		if (!vm._canPerformDecoded(decoded)) {
+			proceed = false;
+			return false;
+		}
+		return true;
 	}
 
+	template <size_t N>
+	inline bool AotFrame::enterRun(uint32_t address, const Mnemonic (&mnemonics)[N]) {
+		vm.instrPtr = address;
+		if (!vm.aotModule || !vm.running)
+			return false;
+
+		if (vm.nextInstrCountInterrupt && vm.instrCount + N > vm.nextInstrCountInterrupt)
+			return false;
+
+		for (auto m : mnemonics) {
+			if (vm.instrPrivileges[static_cast<uint32_t>(m)] > vm.privilegeLevel)
+				return false;
+		}
+
+		auto last = address + static_cast<uint32_t>(N - 1) * 3;
+		auto segmentSize = static_cast<uint32_t>(vm.memory.memory.getSegmentSize());
+		if (address / segmentSize != last / segmentSize)
+			return false;
+
+		auto decoded = vm._fetchDecoded(last);
+		if (!decoded)
+			return false;
+
+		vm.instrCount += N;
+		vm.instrPtr = last + 3;
+		vm.lastExecuted = &decoded->instr;
+		return true;
+	}
+
+	inline bool AotFrame::perform(uint32_t next) {
+		auto instr = vm.lastExecuted;
+		proceed = (vm.*VM::runners[static_cast<uint32_t>(instr->mnemonic) / 128])(instr);
+		return resume() && vm.instrPtr == next;
+	}
+
+	inline bool AotFrame::jump(uint32_t address) {
+		vm.instrPtr = address;
+		return true;
+	}
+
+	inline void AotFrame::test(uint32_t left, uint32_t right) {
+		vm.setControl(left, right);
+	}
+
+	inline bool AotFrame::taken(Mnemonic m) const {
+		return vm.controlByte & VM::_jumpCondition(m);
+	}
+#endif
+
 	inline uint32_t DynamicMemoryHandler::allocateNew(sbl::vm::VM* vm, uint32_t size) {
 		if (size == 0) {
 			vm->error = { ErrorCode::InvalidDynamicSize, vm->instrPtr };
 			vm->running = false;
-			throw ErrorCode::InvalidDynamicSize;
+			vm->_raise(ErrorCode::InvalidDynamicSize);
 		}
 
 		if (lastFreedIdx >= storage.size()) {
@@ -1280,7 +2364,7 @@ namespace sbl::vm {
 		if (idx >= storage.size()) {
 			vm->error = { ErrorCode::InvalidDynamicId, vm->instrPtr };
 			vm->running = false;
-			throw ErrorCode::InvalidDynamicId;
+			vm->_raise(ErrorCode::InvalidDynamicId);
 		}
 		storage[idx].clear();
 		lastFreedIdx = idx;
@@ -1290,7 +2374,7 @@ namespace sbl::vm {
 		if (addr >= storage.size() || !storage[addr].size()) {
 			vm->error = { ErrorCode::InvalidDynamicId, vm->instrPtr };
 			vm->running = false;
-			throw ErrorCode::InvalidDynamicId;
+			vm->_raise(ErrorCode::InvalidDynamicId);
 		}
 		return &storage[addr][0];
 	}
@@ -1299,13 +2383,13 @@ namespace sbl::vm {
 		if (addr >= storage.size() || !storage[addr].size()) {
 			vm->error = { ErrorCode::InvalidDynamicId, vm->instrPtr };
 			vm->running = false;
-			throw ErrorCode::InvalidDynamicId;
+			vm->_raise(ErrorCode::InvalidDynamicId);
 		}
 		auto& dynMem = storage[addr];
 		if (offset >= dynMem.size()) {
 			vm->error = { ErrorCode::InvalidDynamicOffset, vm->instrPtr };
 			vm->running = false;
-			throw ErrorCode::InvalidDynamicOffset;
+			vm->_raise(ErrorCode::InvalidDynamicOffset);
 		}
 		return dynMem[offset];
 	}
@@ -1314,7 +2398,7 @@ namespace sbl::vm {
 		if (addr >= storage.size() || !storage[addr].size()) {
 			vm->error = { ErrorCode::InvalidDynamicId, vm->instrPtr };
 			vm->running = false;
-			throw ErrorCode::InvalidDynamicId;
+			vm->_raise(ErrorCode::InvalidDynamicId);
 		}
 		return (uint32_t)storage[addr].size();
 	}
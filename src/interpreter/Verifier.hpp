@@ -0,0 +1,48 @@
+#pragma once
+
+#ifndef INTERPRETER_VERIFIER_HEADER_H_
+#define INTERPRETER_VERIFIER_HEADER_H_
+
+#include <cstdint>
+
+namespace sbl::vm {
+	/*
+		Load time verifier
+
+		VM::_verify walks every instruction of the program image at the alignment
+		of the entry point and proves that
+			every mnemonic belongs to one of the runners,
+			every register operand names an existing register,
+			every direct jump and call(Jmp_A, J*_A, Call_A and their relative forms)
+			lands on an instruction of the same alignment in an executable segment.
+
+		Programs passing it run on the verified variant of their profile(see Profile.hpp),
+		which skips the mnemonic check of decoded instructions, and in the direct threaded
+		engine the check that their registers got resolved.
+		Code the verifier has not seen, such as instructions reached at another alignment
+		or segments made executable later, is still decoded on demand, and whatever of it
+		fails those checks keeps running through the checked path.
+	*/
+	enum class VerifyResult : uint8_t {
+		Verified,
+		NotVerified,			//No program has been loaded, or it failed to load
+		InvalidMnemonic,
+		InvalidRegisterId,
+		UnalignedTarget,		//Direct jump or call into the middle of an instruction
+		NonExecutableTarget,	//Direct jump or call out of the executable segments
+	};
+
+	struct Verification {
+		VerifyResult result = VerifyResult::NotVerified;
+		//Address of the first instruction that failed the verification
+		uint32_t address = 0;
+		//Number of instructions verified
+		uint32_t instructions = 0;
+
+		bool verified() const {
+			return result == VerifyResult::Verified;
+		}
+	};
+}
+
+#endif	//INTERPRETER_VERIFIER_HEADER_H_
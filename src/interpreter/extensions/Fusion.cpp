@@ -0,0 +1,117 @@
+#include "../VM.hpp"
+#include "../Fusion.hpp"
+#include "../../common/Instruction.hpp"
+
+namespace sbl::vm {
+	/*
+		Runs a group of fused instructions, see Fusion.hpp.
+
+		The whole group has already been counted(see VM::_shouldFuse) and the first
+		instruction fetched and validated. Every following instruction is entered
+		through _enterFused, so instrPtr and lastExecuted are the same as if they ran
+		one by one, and the instructions never entered are taken back from instrCount
+		if the group is left early.
+		The decoded instructions of a group are stored 3 entries apart.
+	*/
+	bool VM::_performFused(DecodedInstruction* first) {
+		auto& pattern = fusionPatterns[first->fusion - 1];
+
+		switch (pattern.kind) {
+			case FusedKind::TestBranch: {
+				auto test = first;
+				auto branch = first + 3;
+
+				if (test->instr.mnemonic == Mnemonic::Test_R_R)
+					setControl(_tryRead(ResolvedRegister{ test->regArg1 }), _tryRead(ResolvedRegister{ test->regArg2 }));
+				else
+					setControl(_tryRead(ResolvedRegister{ test->regArg1 }), _tryRead(Value{ test->instr.arg2 }));
+
+				_enterFused(branch);
+
+				//Same conditions as the relative jumps in Basic.cpp
+				uint32_t condition = 0;
+				switch (branch->instr.mnemonic) {
+					case Mnemonic::RJb_A:
+					case Mnemonic::RJnle_A:
+						condition = TestBigger;
+						break;
+					case Mnemonic::RJnb_A:
+					case Mnemonic::RJle_A:
+						condition = TestSmallerEqual;
+						break;
+					case Mnemonic::RJbe_A:
+					case Mnemonic::RJnl_A:
+						condition = TestBiggerEqual;
+						break;
+					case Mnemonic::RJnbe_A:
+					case Mnemonic::RJl_A:
+						condition = TestSmaller;
+						break;
+					case Mnemonic::RJz_A:
+					case Mnemonic::RJe_A:
+						condition = TestEqual;
+						break;
+					case Mnemonic::RJnz_A:
+					case Mnemonic::RJne_A:
+						condition = TestUnequal;
+						break;
+				}
+
+				if (controlByte & condition) {
+					instrPtr += _tryReadDeref(Address{ branch->instr.arg1 });
+				}
+				break;
+			}
+			case FusedKind::RegisterArithmetic: {
+				auto member = first;
+				for (uint32_t k = 0; k < pattern.length; ++k, member += 3) {
+					if (k)
+						_enterFused(member);
+
+					auto& left = _tryRead(ResolvedRegister{ member->regArg1 });
+					auto right = member->regArg2 ? _tryRead(ResolvedRegister{ member->regArg2 })
+												 : _tryRead(Value{ member->instr.arg2 });
+
+					switch (member->instr.mnemonic) {
+						case Mnemonic::Add_R_R:
+						case Mnemonic::Add_R_V:
+							left += right;
+							break;
+						case Mnemonic::Sub_R_R:
+						case Mnemonic::Sub_R_V:
+							left += ~right + 1;
+							break;
+						case Mnemonic::Mul_R_R:
+						case Mnemonic::Mul_R_V:
+							left *= right;
+							break;
+					}
+				}
+				break;
+			}
+			case FusedKind::Sequence: {
+				auto member = first;
+				//Address of the instruction following the one being run
+				auto next = instrPtr;
+				for (uint32_t k = 0; k < pattern.length; ++k, member += 3) {
+					if (k) {
+						//Previous instruction jumped away or stopped the execution
+						if (!running || instrPtr != next) {
+							_dropPrecharged();
+							return running;
+						}
+						_enterFused(member);
+						next += 3;
+					}
+
+					if (!(this->*member->runner)(&member->instr))
+						return false;
+				}
+				break;
+			}
+		}
+
+		return true;
+	}
+
+}	//sbl::vm
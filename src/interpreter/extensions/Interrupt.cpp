@@ -4,6 +4,9 @@
 
 namespace sbl::vm {
 	bool VM::_performInterrupt(Instruction* instr) {
+		if (!_testProfile(instr))
+			return false;
+
 		switch (instr->mnemonic) {
 			case Mnemonic::Raise_R:
 			{
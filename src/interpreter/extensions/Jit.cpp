@@ -0,0 +1,413 @@
+#include "../VM.hpp"
+#include "../Jit.hpp"
+#include "../../common/Instruction.hpp"
+
+#ifdef SBL_JIT
+
+namespace sbl::vm {
+	namespace {
+		//Shift turning an address into the id of its segment
+		bool segmentShift(size_t segmentSize, uint32_t& shift) {
+			if (segmentSize & (segmentSize - 1))
+				return false;
+
+			shift = 0;
+			while ((size_t(1) << shift) < segmentSize)
+				++shift;
+			return true;
+		}
+	}
+
+	/*
+		Emits the template of an instruction that does not transfer control,
+		returns false if there is none.
+
+		Every instruction that may fail, which are only the memory accesses, checks
+		the segment it accesses the same way Memory::tryAccess does, and jumps to one
+		of the failed fixups before it changes anything. The fixups are turned into
+		side exits by the caller, which point instrPtr at the failing instruction,
+		so the interpreter runs it again with all of its checks, raising the error.
+		Accesses to constant addresses skip the check if hoisted is set, in which case
+		the caller has to check them ahead of time.
+	*/
+	bool VM::_emitInstruction(X64Emitter& emitter, const DecodedInstruction& entry, uint32_t segmentShift,
+								bool hoisted, std::vector<X64Emitter::Fixup>& failed) {
+		using E = X64Emitter;
+
+		constexpr uint8_t readable = static_cast<uint8_t>(SegmentAccessType::Readable);
+		constexpr uint8_t writable = static_cast<uint8_t>(SegmentAccessType::Writable);
+
+		auto& instr = entry.instr;
+
+		auto binary = [&](E::AluOp op) {
+			if (entry.regArg2) {
+				emitter.loadRegister(E::Eax, instr.arg2);
+				emitter.aluRegister(op, instr.arg1, E::Eax);
+			}
+			else {
+				emitter.aluRegister(op, instr.arg1, instr.arg2);
+			}
+		};
+
+		switch (instr.mnemonic) {
+			case Mnemonic::Add_R_R:
+			case Mnemonic::Add_R_V:
+				binary(E::Add);
+				break;
+			case Mnemonic::Sub_R_R:
+			case Mnemonic::Sub_R_V:
+				binary(E::Sub);
+				break;
+			case Mnemonic::And_R_R:
+			case Mnemonic::And_R_V:
+				binary(E::And);
+				break;
+			case Mnemonic::Or_R_R:
+			case Mnemonic::Or_R_V:
+				binary(E::Or);
+				break;
+			case Mnemonic::Xor_R_R:
+			case Mnemonic::Xor_R_V:
+				binary(E::Xor);
+				break;
+			case Mnemonic::Mul_R_R:
+				emitter.loadRegister(E::Eax, instr.arg1);
+				emitter.mulFromRegister(E::Eax, instr.arg2);
+				emitter.storeRegister(instr.arg1, E::Eax);
+				break;
+			case Mnemonic::Mul_R_V:
+				emitter.loadRegister(E::Eax, instr.arg1);
+				emitter.mul(E::Eax, instr.arg2);
+				emitter.storeRegister(instr.arg1, E::Eax);
+				break;
+			case Mnemonic::Inc_R:
+				emitter.aluRegister(E::Add, instr.arg1, 1u);
+				break;
+			case Mnemonic::Dec_R:
+				emitter.aluRegister(E::Add, instr.arg1, static_cast<uint32_t>(-1));
+				break;
+			case Mnemonic::Not_R:
+				emitter.notRegister(instr.arg1);
+				break;
+			case Mnemonic::Test_R_R:
+			case Mnemonic::Test_R_V:
+				emitter.loadRegister(E::Eax, instr.arg1);
+				if (entry.regArg2)
+					emitter.aluFromRegister(E::Cmp, E::Eax, instr.arg2);
+				else
+					emitter.compare(E::Eax, instr.arg2);
+
+				//Same flags as setControl
+				emitter.move(E::Edx, TestSmallerEqual | TestEqual | TestBiggerEqual);
+				emitter.move(E::Ecx, TestBigger | TestUnequal | TestBiggerEqual);
+				emitter.moveIf(E::Above, E::Edx, E::Ecx);
+				emitter.move(E::Ecx, TestSmaller | TestUnequal | TestSmallerEqual);
+				emitter.moveIf(E::Below, E::Edx, E::Ecx);
+				emitter.storeControl(E::Edx);
+				break;
+
+			case Mnemonic::Mov_R_R:
+				emitter.loadRegister(E::Eax, instr.arg2);
+				emitter.storeRegister(instr.arg1, E::Eax);
+				break;
+			case Mnemonic::Mov_R_V:
+				emitter.storeRegister(instr.arg1, instr.arg2);
+				break;
+			case Mnemonic::Mov_R_A:
+				emitter.move(E::Eax, instr.arg2);
+				if (!hoisted)
+					emitter.checkAccess(segmentShift, readable, failed);
+				emitter.loadMemory(E::Edx);
+				emitter.storeRegister(instr.arg1, E::Edx);
+				break;
+			case Mnemonic::Mov_R_I:
+				emitter.loadRegister(E::Eax, instr.arg2);
+				emitter.checkAccess(segmentShift, readable, failed);
+				emitter.loadMemory(E::Edx);
+				emitter.storeRegister(instr.arg1, E::Edx);
+				break;
+			case Mnemonic::Mov_A_R:
+			case Mnemonic::Mov_A_V:
+			case Mnemonic::Mov_I_R:
+			case Mnemonic::Mov_I_V:
+				if (instr.mnemonic == Mnemonic::Mov_A_R || instr.mnemonic == Mnemonic::Mov_A_V) {
+					emitter.move(E::Eax, instr.arg1);
+					if (!hoisted)
+						emitter.checkAccess(segmentShift, writable, failed);
+				}
+				else {
+					emitter.loadRegister(E::Eax, instr.arg1);
+					emitter.checkAccess(segmentShift, writable, failed);
+				}
+
+				if (entry.regArg2) {
+					emitter.loadRegister(E::Edx, instr.arg2);
+					emitter.storeMemory(E::Edx);
+				}
+				else {
+					emitter.storeMemory(instr.arg2);
+				}
+				break;
+
+			default:
+				return false;
+		}
+
+		return true;
+	}
+
+	/*
+		Translates the basic block starting at decoded, see Jit.hpp.
+
+		The instructions are translated one by one, until the end of the block or
+		the first instruction without a template, which is then left to the interpreter.
+		Jumps end the block, so they are always translated last.
+
+		Operands naming instrPtr are never translated, so the code only ever moves
+		instrPtr when it leaves.
+	*/
+	bool VM::_compileBlock(DecodedInstruction* decoded) {
+		constexpr uint32_t instrPtrId = 62;
+		using E = X64Emitter;
+
+		uint32_t shift;
+		if (!segmentShift(memory.memory.getSegmentSize(), shift))
+			return false;
+
+		//Address of the first instruction of the block, instrPtr already points past it
+		auto start = instrPtr - 3;
+
+		X64Emitter emitter;
+		std::vector<E::Fixup> failed;
+		//Side exits with the number of instructions executed before them
+		std::vector<std::pair<E::Fixup, uint32_t>> sideExits;
+
+		emitter.prologue();
+
+		uint32_t length = 0;
+		bool jumped = false;
+		for (; length < decoded->blockLength && !jumped; ++length) {
+			auto& entry = decoded[length * 3];
+			auto& instr = entry.instr;
+
+			if (!(entry.flags & DecodedInstruction::Resolved)
+				|| entry.regArg1 == &registers[instrPtrId] || entry.regArg2 == &registers[instrPtrId])
+				break;
+
+			//Address of the instruction following this one
+			auto next = start + (length + 1) * 3;
+			auto executed = length + 1;
+			failed.clear();
+
+			if (instr.mnemonic == Mnemonic::Jmp_A) {
+				emitter.exit(instrPtrId, instr.arg1, executed);
+				jumped = true;
+			}
+			else if (instr.mnemonic == Mnemonic::Jmp_R) {
+				emitter.loadRegister(E::Eax, instr.arg1);
+				emitter.exit(instrPtrId, E::Eax, executed);
+				jumped = true;
+			}
+			else if (instr.mnemonic == Mnemonic::RJmp_A) {
+				emitter.exit(instrPtrId, next + instr.arg1, executed);
+				jumped = true;
+			}
+			else if (auto mask = _jumpCondition(instr.mnemonic)) {
+				auto target = instr.mnemonic >= Mnemonic::RJmp_A ? next + instr.arg1 : instr.arg1;
+				emitter.testControl(mask);
+				auto notTaken = emitter.jumpIf(E::Zero);
+				emitter.exit(instrPtrId, target, executed);
+				emitter.bind(notTaken);
+				emitter.exit(instrPtrId, next, executed);
+				jumped = true;
+			}
+			else if (!_emitInstruction(emitter, entry, shift, false, failed)) {
+				break;
+			}
+
+			for (auto fixup : failed)
+				sideExits.push_back({ fixup, length });
+		}
+
+		//Too short to be worth leaving the interpreter for
+		if (length < 2)
+			return false;
+
+		if (!jumped)
+			emitter.exit(instrPtrId, start + length * 3, length);
+
+		for (auto& [fixup, executed] : sideExits) {
+			emitter.bind(fixup);
+			emitter.exit(instrPtrId, start + executed * 3, executed);
+		}
+
+		auto code = jitArena.install(emitter.code());
+		if (!code)
+			return false;
+
+		decoded->jitCode = code;
+		decoded->jitLength = static_cast<uint16_t>(length);
+		return true;
+	}
+
+	/*
+		Compiles the loop body recorded by _recordTrace into a trace.
+
+		The recording holds every instruction dispatched from the head of the loop
+		until the execution came back to it. The body is walked from the head
+		along the recorded path, every jump has to go where the recording says
+		it went, and the path has to come back through the Endloop.
+
+		The trace runs the body over and over in the machine code, until:
+			- a conditional jump would go the other way than it did while recording,
+			- the Endloop would leave the loop, that is r10 is 0 or 1,
+			- a memory access fails,
+			- or the next iteration would not fit before the instruction count interrupt.
+		It then leaves through a side exit pointing instrPtr at the instruction
+		that has to run in the interpreter, the same way the blocks do.
+
+		Nothing inside the trace can change access rights or the segment count,
+		so the segments accessed through constant addresses are checked only once
+		before the first iteration, and the register ids were checked while decoding.
+	*/
+	bool VM::_compileTrace() {
+		constexpr uint32_t instrPtrId = 62;
+		constexpr uint32_t loopPtrId = 60;
+		constexpr uint32_t counterId = 10;
+		using E = X64Emitter;
+
+		struct Step {
+			DecodedInstruction* entry;
+			uint32_t address;
+			//Whether the conditional jump was taken while recording
+			bool taken;
+		};
+
+		auto [head, headAddress] = traceRecord.front();
+		if (loopPtr != headAddress)
+			return false;
+
+		uint32_t shift;
+		if (!segmentShift(memory.memory.getSegmentSize(), shift))
+			return false;
+
+		std::vector<Step> steps;
+		//Recorded dispatch expected next
+		size_t next = 1;
+		auto entry = head;
+		auto address = headAddress;
+		while (true) {
+			if (!entry || steps.size() >= MaxTraceLength || !(entry->flags & DecodedInstruction::Resolved))
+				return false;
+
+			auto& instr = entry->instr;
+			for (auto reg : { entry->regArg1, entry->regArg2 }) {
+				if (reg == &registers[instrPtrId] || reg == &registers[loopPtrId])
+					return false;
+			}
+
+			if (instr.mnemonic == Mnemonic::Endloop) {
+				steps.push_back({ entry, address, true });
+				if (next != traceRecord.size())
+					return false;
+				break;
+			}
+
+			auto following = address + 3;
+			auto to = following;
+			bool taken = false;
+			auto condition = _jumpCondition(instr.mnemonic);
+
+			if (condition || instr.mnemonic == Mnemonic::Jmp_A || instr.mnemonic == Mnemonic::RJmp_A) {
+				auto target = instr.mnemonic >= Mnemonic::RJmp_A ? following + instr.arg1 : instr.arg1;
+				//Every jump is followed by a dispatch
+				if (next == traceRecord.size())
+					return false;
+
+				to = traceRecord[next++].second;
+				taken = to == target;
+				if (!taken && (to != following || !condition))
+					return false;
+			}
+			else if (next < traceRecord.size() && traceRecord[next].second == following) {
+				++next;
+			}
+
+			steps.push_back({ entry, address, taken });
+			address = to;
+			entry = _fetchDecoded(to);
+		}
+
+		X64Emitter emitter;
+		std::vector<E::Fixup> failed;
+		std::vector<std::pair<E::Fixup, uint32_t>> sideExits;
+
+		emitter.prologue();
+
+		//Segments accessed through constant addresses
+		for (auto& step : steps) {
+			auto& instr = step.entry->instr;
+			if (instr.mnemonic == Mnemonic::Mov_R_A) {
+				emitter.move(E::Eax, instr.arg2);
+				emitter.checkAccess(shift, static_cast<uint8_t>(SegmentAccessType::Readable), failed);
+			}
+			else if (instr.mnemonic == Mnemonic::Mov_A_R || instr.mnemonic == Mnemonic::Mov_A_V) {
+				emitter.move(E::Eax, instr.arg1);
+				emitter.checkAccess(shift, static_cast<uint8_t>(SegmentAccessType::Writable), failed);
+			}
+		}
+		for (auto fixup : failed)
+			sideExits.push_back({ fixup, 0 });
+
+		auto top = emitter.label();
+		emitter.loadContext(E::Eax, offsetof(JitContext, iterations));
+		emitter.compareContext(E::Eax, offsetof(JitContext, maxIterations));
+		sideExits.push_back({ emitter.jumpIf(E::AboveEqual), 0 });
+
+		for (uint32_t k = 0; k < steps.size(); ++k) {
+			auto& step = steps[k];
+			auto& instr = step.entry->instr;
+			failed.clear();
+
+			if (instr.mnemonic == Mnemonic::Endloop) {
+				emitter.loadRegister(E::Eax, counterId);
+				emitter.compare(E::Eax, 1);
+				failed.push_back(emitter.jumpIf(E::BelowEqual));
+				emitter.aluRegister(E::Add, counterId, static_cast<uint32_t>(-1));
+				emitter.incrementContext(offsetof(JitContext, iterations));
+				emitter.jumpTo(top);
+			}
+			else if (auto mask = _jumpCondition(instr.mnemonic)) {
+				emitter.testControl(mask);
+				failed.push_back(emitter.jumpIf(step.taken ? E::Zero : E::NotZero));
+			}
+			else if (instr.mnemonic == Mnemonic::Jmp_A || instr.mnemonic == Mnemonic::RJmp_A) {
+				//Nothing to do, the next step is already the target
+			}
+			else if (!_emitInstruction(emitter, *step.entry, shift, true, failed)) {
+				return false;
+			}
+
+			for (auto fixup : failed)
+				sideExits.push_back({ fixup, k });
+		}
+
+		for (auto& [fixup, executed] : sideExits) {
+			emitter.bind(fixup);
+			emitter.exit(instrPtrId, steps[executed].address, executed);
+		}
+
+		auto code = jitArena.install(emitter.code());
+		if (!code)
+			return false;
+
+		LoopTrace trace{ code };
+		for (auto& step : steps)
+			trace.instructions.push_back(&step.entry->instr);
+		traces.push_back(std::move(trace));
+		head->trace = static_cast<uint16_t>(traces.size());
+		return true;
+	}
+}	//sbl::vm
+
+#endif	//SBL_JIT
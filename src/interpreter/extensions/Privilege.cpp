@@ -4,6 +4,9 @@
 
 namespace sbl::vm {
 	bool VM::_performPrivilege(Instruction* instr) {
+		if (!_testProfile(instr))
+			return false;
+
 		switch (instr->mnemonic) {
 			case Mnemonic::GetPrivlg_R:
 				_tryWrite(Register{ instr->arg1 }, privilegeLevel);
@@ -59,6 +62,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_R_A:
@@ -78,6 +82,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_R_I:
@@ -97,6 +102,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_R_V:
@@ -116,6 +122,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_A_R:
@@ -135,6 +142,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_A_A:
@@ -154,6 +162,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_A_I:
@@ -173,6 +182,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_A_V:
@@ -192,6 +202,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_I_R:
@@ -211,6 +222,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_I_A:
@@ -230,6 +242,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_I_I:
@@ -249,6 +262,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_I_V:
@@ -268,6 +282,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_V_R:
@@ -287,6 +302,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_V_A:
@@ -306,6 +322,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_V_I:
@@ -325,6 +342,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::SetInstrPrivlg_V_V:
@@ -344,6 +362,7 @@ namespace sbl::vm {
 
 				if (!_testPrivilege(v2, instr)) return false;
 				instrPrivileges[v1] = v2;
+				++privilegeEpoch;
 			}
 			break;
 			case Mnemonic::GetInstrPrivlg_R_R:
@@ -0,0 +1,3234 @@
+#include <cmath>
+#include "../VM.hpp"
+#include "../../common/Instruction.hpp"
+
+#ifdef SBL_TAIL_CALL
+
+namespace sbl::vm {
+	/*
+		Tail call dispatch engine, enabled by SBL_TAIL_CALL(see Config.hpp).
+
+		Every mnemonic of the Basic, Arithmetic, Logical and Floating point chunks has
+		its own handler, an instantiation of VM::_tailHandler. Every handler runs its
+		instruction(VM::_tailRun) followed by its own copy of the dispatch(VM::_tailFetch),
+		and then tail calls the handler of the next instruction through tailHandlers.
+		The handlers are static, so that call goes through a plain function pointer,
+		and they never return to the loop until it ends. Just like in the direct threaded
+		engine(see Threaded.cpp) every executed instruction costs a single indirect jump,
+		but the engine is plain C++ instead of computed goto, and the register and memory
+		helpers get inlined into every handler on their own.
+
+		The handlers are the bodies of the switches from Basic.cpp, Arithmetic.cpp, Logical.cpp
+		and Float.cpp, and have to be kept in sync with them. Allocation, Interrupt and Privilege
+		instructions, unassigned mnemonics of a valid chunk, and instructions whose registers
+		failed to resolve go through runners[] from VM::_tailFallback, and fused groups
+		(see Fusion.hpp) are run by VM::_tailFused. Instructions outside of decoded segments
+		are run through runners[] right from VM::_tailFetch, the same way VM::_execute does.
+		The engine is instantiated once per feature profile(see Profile.hpp).
+	*/
+	template <class Profile>
+	const std::array<VM::TailHandler, static_cast<uint32_t>(Mnemonic::TotalCount)> VM::tailHandlers = [] {
+		std::array<TailHandler, static_cast<uint32_t>(Mnemonic::TotalCount)> handlers;
+		handlers.fill(&_tailFallback<Profile>);
+
+		handlers[static_cast<uint32_t>(Mnemonic::Nop)] = &_tailHandler<Profile, Mnemonic::Nop>;
+		handlers[static_cast<uint32_t>(Mnemonic::Halt)] = &_tailHandler<Profile, Mnemonic::Halt>;
+		handlers[static_cast<uint32_t>(Mnemonic::End)] = &_tailHandler<Profile, Mnemonic::End>;
+		handlers[static_cast<uint32_t>(Mnemonic::Ret)] = &_tailHandler<Profile, Mnemonic::Ret>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loop)] = &_tailHandler<Profile, Mnemonic::Loop>;
+		handlers[static_cast<uint32_t>(Mnemonic::Endloop)] = &_tailHandler<Profile, Mnemonic::Endloop>;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_R)] = &_tailHandler<Profile, Mnemonic::Push_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_A)] = &_tailHandler<Profile, Mnemonic::Push_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_I)] = &_tailHandler<Profile, Mnemonic::Push_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_V)] = &_tailHandler<Profile, Mnemonic::Push_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_All)] = &_tailHandler<Profile, Mnemonic::Push_All>;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_R)] = &_tailHandler<Profile, Mnemonic::Pop_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_A)] = &_tailHandler<Profile, Mnemonic::Pop_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_I)] = &_tailHandler<Profile, Mnemonic::Pop_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_All)] = &_tailHandler<Profile, Mnemonic::Pop_All>;
+		handlers[static_cast<uint32_t>(Mnemonic::Clear_All)] = &_tailHandler<Profile, Mnemonic::Clear_All>;
+		handlers[static_cast<uint32_t>(Mnemonic::Inc_R)] = &_tailHandler<Profile, Mnemonic::Inc_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Inc_A)] = &_tailHandler<Profile, Mnemonic::Inc_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Inc_I)] = &_tailHandler<Profile, Mnemonic::Inc_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Dec_R)] = &_tailHandler<Profile, Mnemonic::Dec_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Dec_A)] = &_tailHandler<Profile, Mnemonic::Dec_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Dec_I)] = &_tailHandler<Profile, Mnemonic::Dec_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Call_R)] = &_tailHandler<Profile, Mnemonic::Call_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Call_A)] = &_tailHandler<Profile, Mnemonic::Call_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Call_I)] = &_tailHandler<Profile, Mnemonic::Call_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RCall_R)] = &_tailHandler<Profile, Mnemonic::RCall_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RCall_A)] = &_tailHandler<Profile, Mnemonic::RCall_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RCall_I)] = &_tailHandler<Profile, Mnemonic::RCall_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Read_R)] = &_tailHandler<Profile, Mnemonic::Read_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Read_A)] = &_tailHandler<Profile, Mnemonic::Read_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Read_I)] = &_tailHandler<Profile, Mnemonic::Read_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Readstr_A)] = &_tailHandler<Profile, Mnemonic::Readstr_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Readstr_I)] = &_tailHandler<Profile, Mnemonic::Readstr_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_R)] = &_tailHandler<Profile, Mnemonic::Print_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_A)] = &_tailHandler<Profile, Mnemonic::Print_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_I)] = &_tailHandler<Profile, Mnemonic::Print_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_V)] = &_tailHandler<Profile, Mnemonic::Print_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_R)] = &_tailHandler<Profile, Mnemonic::PrintS_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_A)] = &_tailHandler<Profile, Mnemonic::PrintS_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_I)] = &_tailHandler<Profile, Mnemonic::PrintS_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_V)] = &_tailHandler<Profile, Mnemonic::PrintS_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_R)] = &_tailHandler<Profile, Mnemonic::PrintC_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_A)] = &_tailHandler<Profile, Mnemonic::PrintC_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_I)] = &_tailHandler<Profile, Mnemonic::PrintC_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_V)] = &_tailHandler<Profile, Mnemonic::PrintC_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Printstr_A)] = &_tailHandler<Profile, Mnemonic::Printstr_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Printstr_I)] = &_tailHandler<Profile, Mnemonic::Printstr_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jmp_R)] = &_tailHandler<Profile, Mnemonic::Jmp_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jmp_A)] = &_tailHandler<Profile, Mnemonic::Jmp_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jmp_I)] = &_tailHandler<Profile, Mnemonic::Jmp_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jb_R)] = &_tailHandler<Profile, Mnemonic::Jb_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnle_R)] = &_tailHandler<Profile, Mnemonic::Jnle_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jb_A)] = &_tailHandler<Profile, Mnemonic::Jb_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnle_A)] = &_tailHandler<Profile, Mnemonic::Jnle_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jb_I)] = &_tailHandler<Profile, Mnemonic::Jb_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnle_I)] = &_tailHandler<Profile, Mnemonic::Jnle_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnb_R)] = &_tailHandler<Profile, Mnemonic::Jnb_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jle_R)] = &_tailHandler<Profile, Mnemonic::Jle_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnb_A)] = &_tailHandler<Profile, Mnemonic::Jnb_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jle_A)] = &_tailHandler<Profile, Mnemonic::Jle_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnb_I)] = &_tailHandler<Profile, Mnemonic::Jnb_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jle_I)] = &_tailHandler<Profile, Mnemonic::Jle_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jbe_R)] = &_tailHandler<Profile, Mnemonic::Jbe_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnl_R)] = &_tailHandler<Profile, Mnemonic::Jnl_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jbe_A)] = &_tailHandler<Profile, Mnemonic::Jbe_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnl_A)] = &_tailHandler<Profile, Mnemonic::Jnl_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jbe_I)] = &_tailHandler<Profile, Mnemonic::Jbe_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnl_I)] = &_tailHandler<Profile, Mnemonic::Jnl_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnbe_R)] = &_tailHandler<Profile, Mnemonic::Jnbe_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jl_R)] = &_tailHandler<Profile, Mnemonic::Jl_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnbe_A)] = &_tailHandler<Profile, Mnemonic::Jnbe_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jl_A)] = &_tailHandler<Profile, Mnemonic::Jl_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnbe_I)] = &_tailHandler<Profile, Mnemonic::Jnbe_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jl_I)] = &_tailHandler<Profile, Mnemonic::Jl_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jz_R)] = &_tailHandler<Profile, Mnemonic::Jz_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Je_R)] = &_tailHandler<Profile, Mnemonic::Je_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jz_A)] = &_tailHandler<Profile, Mnemonic::Jz_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Je_A)] = &_tailHandler<Profile, Mnemonic::Je_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jz_I)] = &_tailHandler<Profile, Mnemonic::Jz_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Je_I)] = &_tailHandler<Profile, Mnemonic::Je_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnz_R)] = &_tailHandler<Profile, Mnemonic::Jnz_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jne_R)] = &_tailHandler<Profile, Mnemonic::Jne_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnz_A)] = &_tailHandler<Profile, Mnemonic::Jnz_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jne_A)] = &_tailHandler<Profile, Mnemonic::Jne_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnz_I)] = &_tailHandler<Profile, Mnemonic::Jnz_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Jne_I)] = &_tailHandler<Profile, Mnemonic::Jne_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJmp_R)] = &_tailHandler<Profile, Mnemonic::RJmp_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJmp_A)] = &_tailHandler<Profile, Mnemonic::RJmp_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJmp_I)] = &_tailHandler<Profile, Mnemonic::RJmp_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJb_R)] = &_tailHandler<Profile, Mnemonic::RJb_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnle_R)] = &_tailHandler<Profile, Mnemonic::RJnle_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJb_A)] = &_tailHandler<Profile, Mnemonic::RJb_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnle_A)] = &_tailHandler<Profile, Mnemonic::RJnle_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJb_I)] = &_tailHandler<Profile, Mnemonic::RJb_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnle_I)] = &_tailHandler<Profile, Mnemonic::RJnle_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnb_R)] = &_tailHandler<Profile, Mnemonic::RJnb_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJle_R)] = &_tailHandler<Profile, Mnemonic::RJle_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnb_A)] = &_tailHandler<Profile, Mnemonic::RJnb_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJle_A)] = &_tailHandler<Profile, Mnemonic::RJle_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnb_I)] = &_tailHandler<Profile, Mnemonic::RJnb_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJle_I)] = &_tailHandler<Profile, Mnemonic::RJle_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJbe_R)] = &_tailHandler<Profile, Mnemonic::RJbe_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnl_R)] = &_tailHandler<Profile, Mnemonic::RJnl_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJbe_A)] = &_tailHandler<Profile, Mnemonic::RJbe_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnl_A)] = &_tailHandler<Profile, Mnemonic::RJnl_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJbe_I)] = &_tailHandler<Profile, Mnemonic::RJbe_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnl_I)] = &_tailHandler<Profile, Mnemonic::RJnl_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnbe_R)] = &_tailHandler<Profile, Mnemonic::RJnbe_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJl_R)] = &_tailHandler<Profile, Mnemonic::RJl_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnbe_A)] = &_tailHandler<Profile, Mnemonic::RJnbe_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJl_A)] = &_tailHandler<Profile, Mnemonic::RJl_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnbe_I)] = &_tailHandler<Profile, Mnemonic::RJnbe_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJl_I)] = &_tailHandler<Profile, Mnemonic::RJl_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJz_R)] = &_tailHandler<Profile, Mnemonic::RJz_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJe_R)] = &_tailHandler<Profile, Mnemonic::RJe_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJz_A)] = &_tailHandler<Profile, Mnemonic::RJz_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJe_A)] = &_tailHandler<Profile, Mnemonic::RJe_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJz_I)] = &_tailHandler<Profile, Mnemonic::RJz_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJe_I)] = &_tailHandler<Profile, Mnemonic::RJe_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnz_R)] = &_tailHandler<Profile, Mnemonic::RJnz_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJne_R)] = &_tailHandler<Profile, Mnemonic::RJne_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnz_A)] = &_tailHandler<Profile, Mnemonic::RJnz_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJne_A)] = &_tailHandler<Profile, Mnemonic::RJne_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnz_I)] = &_tailHandler<Profile, Mnemonic::RJnz_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RJne_I)] = &_tailHandler<Profile, Mnemonic::RJne_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Time_R)] = &_tailHandler<Profile, Mnemonic::Time_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Time_A)] = &_tailHandler<Profile, Mnemonic::Time_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Time_I)] = &_tailHandler<Profile, Mnemonic::Time_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Time64_R)] = &_tailHandler<Profile, Mnemonic::Time64_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Time64_A)] = &_tailHandler<Profile, Mnemonic::Time64_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Time64_I)] = &_tailHandler<Profile, Mnemonic::Time64_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount_R)] = &_tailHandler<Profile, Mnemonic::ICount_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount_A)] = &_tailHandler<Profile, Mnemonic::ICount_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount_I)] = &_tailHandler<Profile, Mnemonic::ICount_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount64_R)] = &_tailHandler<Profile, Mnemonic::ICount64_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount64_A)] = &_tailHandler<Profile, Mnemonic::ICount64_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount64_I)] = &_tailHandler<Profile, Mnemonic::ICount64_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::ExecInstr_A)] = &_tailHandler<Profile, Mnemonic::ExecInstr_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::ExecInstr_I)] = &_tailHandler<Profile, Mnemonic::ExecInstr_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_R)] = &_tailHandler<Profile, Mnemonic::Mov_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_A)] = &_tailHandler<Profile, Mnemonic::Mov_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_I)] = &_tailHandler<Profile, Mnemonic::Mov_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_V)] = &_tailHandler<Profile, Mnemonic::Mov_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_R)] = &_tailHandler<Profile, Mnemonic::Mov_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_A)] = &_tailHandler<Profile, Mnemonic::Mov_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_I)] = &_tailHandler<Profile, Mnemonic::Mov_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_V)] = &_tailHandler<Profile, Mnemonic::Mov_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_R)] = &_tailHandler<Profile, Mnemonic::Mov_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_A)] = &_tailHandler<Profile, Mnemonic::Mov_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_I)] = &_tailHandler<Profile, Mnemonic::Mov_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_V)] = &_tailHandler<Profile, Mnemonic::Mov_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_R)] = &_tailHandler<Profile, Mnemonic::Move_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_R)] = &_tailHandler<Profile, Mnemonic::Movz_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_A)] = &_tailHandler<Profile, Mnemonic::Move_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_A)] = &_tailHandler<Profile, Mnemonic::Movz_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_I)] = &_tailHandler<Profile, Mnemonic::Move_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_I)] = &_tailHandler<Profile, Mnemonic::Movz_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_V)] = &_tailHandler<Profile, Mnemonic::Move_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_V)] = &_tailHandler<Profile, Mnemonic::Movz_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_R)] = &_tailHandler<Profile, Mnemonic::Move_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_R)] = &_tailHandler<Profile, Mnemonic::Movz_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_A)] = &_tailHandler<Profile, Mnemonic::Move_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_A)] = &_tailHandler<Profile, Mnemonic::Movz_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_I)] = &_tailHandler<Profile, Mnemonic::Move_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_I)] = &_tailHandler<Profile, Mnemonic::Movz_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_V)] = &_tailHandler<Profile, Mnemonic::Move_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_V)] = &_tailHandler<Profile, Mnemonic::Movz_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_R)] = &_tailHandler<Profile, Mnemonic::Move_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_R)] = &_tailHandler<Profile, Mnemonic::Movz_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_A)] = &_tailHandler<Profile, Mnemonic::Move_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_A)] = &_tailHandler<Profile, Mnemonic::Movz_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_I)] = &_tailHandler<Profile, Mnemonic::Move_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_I)] = &_tailHandler<Profile, Mnemonic::Movz_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_V)] = &_tailHandler<Profile, Mnemonic::Move_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_V)] = &_tailHandler<Profile, Mnemonic::Movz_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_R)] = &_tailHandler<Profile, Mnemonic::Movne_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_R)] = &_tailHandler<Profile, Mnemonic::Movnz_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_A)] = &_tailHandler<Profile, Mnemonic::Movne_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_A)] = &_tailHandler<Profile, Mnemonic::Movnz_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_I)] = &_tailHandler<Profile, Mnemonic::Movne_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_I)] = &_tailHandler<Profile, Mnemonic::Movnz_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_V)] = &_tailHandler<Profile, Mnemonic::Movne_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_V)] = &_tailHandler<Profile, Mnemonic::Movnz_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_R)] = &_tailHandler<Profile, Mnemonic::Movne_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_R)] = &_tailHandler<Profile, Mnemonic::Movnz_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_A)] = &_tailHandler<Profile, Mnemonic::Movne_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_A)] = &_tailHandler<Profile, Mnemonic::Movnz_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_I)] = &_tailHandler<Profile, Mnemonic::Movne_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_I)] = &_tailHandler<Profile, Mnemonic::Movnz_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_V)] = &_tailHandler<Profile, Mnemonic::Movne_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_V)] = &_tailHandler<Profile, Mnemonic::Movnz_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_R)] = &_tailHandler<Profile, Mnemonic::Movne_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_R)] = &_tailHandler<Profile, Mnemonic::Movnz_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_A)] = &_tailHandler<Profile, Mnemonic::Movne_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_A)] = &_tailHandler<Profile, Mnemonic::Movnz_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_I)] = &_tailHandler<Profile, Mnemonic::Movne_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_I)] = &_tailHandler<Profile, Mnemonic::Movnz_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_V)] = &_tailHandler<Profile, Mnemonic::Movne_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_V)] = &_tailHandler<Profile, Mnemonic::Movnz_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_R_A)] = &_tailHandler<Profile, Mnemonic::Laddr_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_R_I)] = &_tailHandler<Profile, Mnemonic::Laddr_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_A_A)] = &_tailHandler<Profile, Mnemonic::Laddr_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_A_I)] = &_tailHandler<Profile, Mnemonic::Laddr_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_I_A)] = &_tailHandler<Profile, Mnemonic::Laddr_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_I_I)] = &_tailHandler<Profile, Mnemonic::Laddr_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_R_A)] = &_tailHandler<Profile, Mnemonic::Loadload_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_R_I)] = &_tailHandler<Profile, Mnemonic::Loadload_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_A_A)] = &_tailHandler<Profile, Mnemonic::Loadload_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_A_I)] = &_tailHandler<Profile, Mnemonic::Loadload_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_I_A)] = &_tailHandler<Profile, Mnemonic::Loadload_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_I_I)] = &_tailHandler<Profile, Mnemonic::Loadload_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_R)] = &_tailHandler<Profile, Mnemonic::Vcall_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_A)] = &_tailHandler<Profile, Mnemonic::Vcall_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_I)] = &_tailHandler<Profile, Mnemonic::Vcall_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_V)] = &_tailHandler<Profile, Mnemonic::Vcall_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_R)] = &_tailHandler<Profile, Mnemonic::Vcall_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_A)] = &_tailHandler<Profile, Mnemonic::Vcall_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_I)] = &_tailHandler<Profile, Mnemonic::Vcall_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_V)] = &_tailHandler<Profile, Mnemonic::Vcall_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_R)] = &_tailHandler<Profile, Mnemonic::Vcall_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_A)] = &_tailHandler<Profile, Mnemonic::Vcall_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_I)] = &_tailHandler<Profile, Mnemonic::Vcall_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_V)] = &_tailHandler<Profile, Mnemonic::Vcall_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_R)] = &_tailHandler<Profile, Mnemonic::Vcall_V_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_A)] = &_tailHandler<Profile, Mnemonic::Vcall_V_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_I)] = &_tailHandler<Profile, Mnemonic::Vcall_V_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_V)] = &_tailHandler<Profile, Mnemonic::Vcall_V_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_R)] = &_tailHandler<Profile, Mnemonic::RVcall_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_A)] = &_tailHandler<Profile, Mnemonic::RVcall_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_I)] = &_tailHandler<Profile, Mnemonic::RVcall_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_V)] = &_tailHandler<Profile, Mnemonic::RVcall_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_R)] = &_tailHandler<Profile, Mnemonic::RVcall_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_A)] = &_tailHandler<Profile, Mnemonic::RVcall_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_I)] = &_tailHandler<Profile, Mnemonic::RVcall_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_V)] = &_tailHandler<Profile, Mnemonic::RVcall_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_R)] = &_tailHandler<Profile, Mnemonic::RVcall_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_A)] = &_tailHandler<Profile, Mnemonic::RVcall_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_I)] = &_tailHandler<Profile, Mnemonic::RVcall_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_V)] = &_tailHandler<Profile, Mnemonic::RVcall_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_R)] = &_tailHandler<Profile, Mnemonic::RVcall_V_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_A)] = &_tailHandler<Profile, Mnemonic::RVcall_V_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_I)] = &_tailHandler<Profile, Mnemonic::RVcall_V_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_V)] = &_tailHandler<Profile, Mnemonic::RVcall_V_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_R)] = &_tailHandler<Profile, Mnemonic::NtvCall_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_A)] = &_tailHandler<Profile, Mnemonic::NtvCall_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_I)] = &_tailHandler<Profile, Mnemonic::NtvCall_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_V)] = &_tailHandler<Profile, Mnemonic::NtvCall_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_R_A)] = &_tailHandler<Profile, Mnemonic::GetNtvId_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_R_I)] = &_tailHandler<Profile, Mnemonic::GetNtvId_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_A_A)] = &_tailHandler<Profile, Mnemonic::GetNtvId_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_A_I)] = &_tailHandler<Profile, Mnemonic::GetNtvId_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_I_A)] = &_tailHandler<Profile, Mnemonic::GetNtvId_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_I_I)] = &_tailHandler<Profile, Mnemonic::GetNtvId_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_R_R)] = &_tailHandler<Profile, Mnemonic::Xchg_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_R_A)] = &_tailHandler<Profile, Mnemonic::Xchg_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_R_I)] = &_tailHandler<Profile, Mnemonic::Xchg_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_A_R)] = &_tailHandler<Profile, Mnemonic::Xchg_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_A_A)] = &_tailHandler<Profile, Mnemonic::Xchg_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_A_I)] = &_tailHandler<Profile, Mnemonic::Xchg_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_I_R)] = &_tailHandler<Profile, Mnemonic::Xchg_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_I_A)] = &_tailHandler<Profile, Mnemonic::Xchg_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_I_I)] = &_tailHandler<Profile, Mnemonic::Xchg_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::ClrCb)] = &_tailHandler<Profile, Mnemonic::ClrCb>;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_A_A)] = &_tailHandler<Profile, Mnemonic::Hotpatch_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_A_I)] = &_tailHandler<Profile, Mnemonic::Hotpatch_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_I_A)] = &_tailHandler<Profile, Mnemonic::Hotpatch_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_I_I)] = &_tailHandler<Profile, Mnemonic::Hotpatch_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_A_A)] = &_tailHandler<Profile, Mnemonic::RHotpatch_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_A_I)] = &_tailHandler<Profile, Mnemonic::RHotpatch_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_I_A)] = &_tailHandler<Profile, Mnemonic::RHotpatch_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_I_I)] = &_tailHandler<Profile, Mnemonic::RHotpatch_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_R)] = &_tailHandler<Profile, Mnemonic::EnableExt_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_A)] = &_tailHandler<Profile, Mnemonic::EnableExt_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_I)] = &_tailHandler<Profile, Mnemonic::EnableExt_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_V)] = &_tailHandler<Profile, Mnemonic::EnableExt_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_R)] = &_tailHandler<Profile, Mnemonic::DisableExt_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_A)] = &_tailHandler<Profile, Mnemonic::DisableExt_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_I)] = &_tailHandler<Profile, Mnemonic::DisableExt_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_V)] = &_tailHandler<Profile, Mnemonic::DisableExt_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_R)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_A)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_I)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_V)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_R)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_A)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_I)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_V)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_R)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_A)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_I)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_V)] = &_tailHandler<Profile, Mnemonic::IsExtEnabled_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_R)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_A)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_I)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_V)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_R)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_A)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_I)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_V)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_R)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_A)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_I)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_V)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_R)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_V_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_A)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_V_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_I)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_V_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_V)] = &_tailHandler<Profile, Mnemonic::SetSegmntAccs_V_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_R)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_A)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_I)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_V)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_R)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_A)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_I)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_V)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_R)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_A)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_I)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_V)] = &_tailHandler<Profile, Mnemonic::GetSegmntAccs_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_R)] = &_tailHandler<Profile, Mnemonic::Add_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_I)] = &_tailHandler<Profile, Mnemonic::Add_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_A)] = &_tailHandler<Profile, Mnemonic::Add_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_V)] = &_tailHandler<Profile, Mnemonic::Add_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_R)] = &_tailHandler<Profile, Mnemonic::Add_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_I)] = &_tailHandler<Profile, Mnemonic::Add_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_A)] = &_tailHandler<Profile, Mnemonic::Add_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_V)] = &_tailHandler<Profile, Mnemonic::Add_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_R)] = &_tailHandler<Profile, Mnemonic::Add_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_I)] = &_tailHandler<Profile, Mnemonic::Add_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_A)] = &_tailHandler<Profile, Mnemonic::Add_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_V)] = &_tailHandler<Profile, Mnemonic::Add_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_R)] = &_tailHandler<Profile, Mnemonic::Sub_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_A)] = &_tailHandler<Profile, Mnemonic::Sub_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_I)] = &_tailHandler<Profile, Mnemonic::Sub_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_V)] = &_tailHandler<Profile, Mnemonic::Sub_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_R)] = &_tailHandler<Profile, Mnemonic::Sub_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_A)] = &_tailHandler<Profile, Mnemonic::Sub_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_I)] = &_tailHandler<Profile, Mnemonic::Sub_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_V)] = &_tailHandler<Profile, Mnemonic::Sub_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_R)] = &_tailHandler<Profile, Mnemonic::Sub_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_A)] = &_tailHandler<Profile, Mnemonic::Sub_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_I)] = &_tailHandler<Profile, Mnemonic::Sub_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_V)] = &_tailHandler<Profile, Mnemonic::Sub_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_R)] = &_tailHandler<Profile, Mnemonic::Mul_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_A)] = &_tailHandler<Profile, Mnemonic::Mul_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_I)] = &_tailHandler<Profile, Mnemonic::Mul_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_V)] = &_tailHandler<Profile, Mnemonic::Mul_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_R)] = &_tailHandler<Profile, Mnemonic::Mul_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_A)] = &_tailHandler<Profile, Mnemonic::Mul_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_I)] = &_tailHandler<Profile, Mnemonic::Mul_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_V)] = &_tailHandler<Profile, Mnemonic::Mul_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_R)] = &_tailHandler<Profile, Mnemonic::Mul_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_A)] = &_tailHandler<Profile, Mnemonic::Mul_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_I)] = &_tailHandler<Profile, Mnemonic::Mul_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_V)] = &_tailHandler<Profile, Mnemonic::Mul_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_R)] = &_tailHandler<Profile, Mnemonic::Div_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_A)] = &_tailHandler<Profile, Mnemonic::Div_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_I)] = &_tailHandler<Profile, Mnemonic::Div_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_V)] = &_tailHandler<Profile, Mnemonic::Div_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_R)] = &_tailHandler<Profile, Mnemonic::Div_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_A)] = &_tailHandler<Profile, Mnemonic::Div_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_I)] = &_tailHandler<Profile, Mnemonic::Div_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_V)] = &_tailHandler<Profile, Mnemonic::Div_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_R)] = &_tailHandler<Profile, Mnemonic::Div_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_A)] = &_tailHandler<Profile, Mnemonic::Div_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_I)] = &_tailHandler<Profile, Mnemonic::Div_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_V)] = &_tailHandler<Profile, Mnemonic::Div_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_R)] = &_tailHandler<Profile, Mnemonic::Mod_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_A)] = &_tailHandler<Profile, Mnemonic::Mod_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_I)] = &_tailHandler<Profile, Mnemonic::Mod_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_V)] = &_tailHandler<Profile, Mnemonic::Mod_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_R)] = &_tailHandler<Profile, Mnemonic::Mod_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_A)] = &_tailHandler<Profile, Mnemonic::Mod_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_I)] = &_tailHandler<Profile, Mnemonic::Mod_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_V)] = &_tailHandler<Profile, Mnemonic::Mod_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_R)] = &_tailHandler<Profile, Mnemonic::Mod_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_A)] = &_tailHandler<Profile, Mnemonic::Mod_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_I)] = &_tailHandler<Profile, Mnemonic::Mod_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_V)] = &_tailHandler<Profile, Mnemonic::Mod_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_R)] = &_tailHandler<Profile, Mnemonic::Lsh_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_A)] = &_tailHandler<Profile, Mnemonic::Lsh_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_I)] = &_tailHandler<Profile, Mnemonic::Lsh_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_V)] = &_tailHandler<Profile, Mnemonic::Lsh_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_R)] = &_tailHandler<Profile, Mnemonic::Lsh_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_A)] = &_tailHandler<Profile, Mnemonic::Lsh_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_I)] = &_tailHandler<Profile, Mnemonic::Lsh_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_V)] = &_tailHandler<Profile, Mnemonic::Lsh_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_R)] = &_tailHandler<Profile, Mnemonic::Lsh_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_A)] = &_tailHandler<Profile, Mnemonic::Lsh_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_I)] = &_tailHandler<Profile, Mnemonic::Lsh_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_V)] = &_tailHandler<Profile, Mnemonic::Lsh_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_R)] = &_tailHandler<Profile, Mnemonic::Rlsh_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_A)] = &_tailHandler<Profile, Mnemonic::Rlsh_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_I)] = &_tailHandler<Profile, Mnemonic::Rlsh_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_V)] = &_tailHandler<Profile, Mnemonic::Rlsh_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_R)] = &_tailHandler<Profile, Mnemonic::Rlsh_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_A)] = &_tailHandler<Profile, Mnemonic::Rlsh_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_I)] = &_tailHandler<Profile, Mnemonic::Rlsh_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_V)] = &_tailHandler<Profile, Mnemonic::Rlsh_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_R)] = &_tailHandler<Profile, Mnemonic::Rlsh_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_A)] = &_tailHandler<Profile, Mnemonic::Rlsh_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_I)] = &_tailHandler<Profile, Mnemonic::Rlsh_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_V)] = &_tailHandler<Profile, Mnemonic::Rlsh_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_R)] = &_tailHandler<Profile, Mnemonic::Rsh_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_A)] = &_tailHandler<Profile, Mnemonic::Rsh_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_I)] = &_tailHandler<Profile, Mnemonic::Rsh_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_V)] = &_tailHandler<Profile, Mnemonic::Rsh_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_R)] = &_tailHandler<Profile, Mnemonic::Rsh_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_A)] = &_tailHandler<Profile, Mnemonic::Rsh_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_I)] = &_tailHandler<Profile, Mnemonic::Rsh_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_V)] = &_tailHandler<Profile, Mnemonic::Rsh_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_R)] = &_tailHandler<Profile, Mnemonic::Rsh_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_A)] = &_tailHandler<Profile, Mnemonic::Rsh_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_I)] = &_tailHandler<Profile, Mnemonic::Rsh_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_V)] = &_tailHandler<Profile, Mnemonic::Rsh_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_R)] = &_tailHandler<Profile, Mnemonic::Rrsh_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_A)] = &_tailHandler<Profile, Mnemonic::Rrsh_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_I)] = &_tailHandler<Profile, Mnemonic::Rrsh_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_V)] = &_tailHandler<Profile, Mnemonic::Rrsh_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_R)] = &_tailHandler<Profile, Mnemonic::Rrsh_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_A)] = &_tailHandler<Profile, Mnemonic::Rrsh_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_I)] = &_tailHandler<Profile, Mnemonic::Rrsh_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_V)] = &_tailHandler<Profile, Mnemonic::Rrsh_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_R)] = &_tailHandler<Profile, Mnemonic::Rrsh_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_A)] = &_tailHandler<Profile, Mnemonic::Rrsh_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_I)] = &_tailHandler<Profile, Mnemonic::Rrsh_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_V)] = &_tailHandler<Profile, Mnemonic::Rrsh_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_R)] = &_tailHandler<Profile, Mnemonic::And_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_A)] = &_tailHandler<Profile, Mnemonic::And_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_I)] = &_tailHandler<Profile, Mnemonic::And_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_V)] = &_tailHandler<Profile, Mnemonic::And_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_R)] = &_tailHandler<Profile, Mnemonic::And_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_A)] = &_tailHandler<Profile, Mnemonic::And_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_I)] = &_tailHandler<Profile, Mnemonic::And_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_V)] = &_tailHandler<Profile, Mnemonic::And_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_R)] = &_tailHandler<Profile, Mnemonic::And_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_A)] = &_tailHandler<Profile, Mnemonic::And_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_I)] = &_tailHandler<Profile, Mnemonic::And_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_V)] = &_tailHandler<Profile, Mnemonic::And_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_R)] = &_tailHandler<Profile, Mnemonic::Or_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_A)] = &_tailHandler<Profile, Mnemonic::Or_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_I)] = &_tailHandler<Profile, Mnemonic::Or_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_V)] = &_tailHandler<Profile, Mnemonic::Or_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_R)] = &_tailHandler<Profile, Mnemonic::Or_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_A)] = &_tailHandler<Profile, Mnemonic::Or_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_I)] = &_tailHandler<Profile, Mnemonic::Or_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_V)] = &_tailHandler<Profile, Mnemonic::Or_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_R)] = &_tailHandler<Profile, Mnemonic::Or_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_A)] = &_tailHandler<Profile, Mnemonic::Or_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_I)] = &_tailHandler<Profile, Mnemonic::Or_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_V)] = &_tailHandler<Profile, Mnemonic::Or_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_R)] = &_tailHandler<Profile, Mnemonic::Xor_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_A)] = &_tailHandler<Profile, Mnemonic::Xor_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_I)] = &_tailHandler<Profile, Mnemonic::Xor_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_V)] = &_tailHandler<Profile, Mnemonic::Xor_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_R)] = &_tailHandler<Profile, Mnemonic::Xor_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_A)] = &_tailHandler<Profile, Mnemonic::Xor_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_I)] = &_tailHandler<Profile, Mnemonic::Xor_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_V)] = &_tailHandler<Profile, Mnemonic::Xor_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_R)] = &_tailHandler<Profile, Mnemonic::Xor_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_A)] = &_tailHandler<Profile, Mnemonic::Xor_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_I)] = &_tailHandler<Profile, Mnemonic::Xor_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_V)] = &_tailHandler<Profile, Mnemonic::Xor_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_R)] = &_tailHandler<Profile, Mnemonic::Eq_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_A)] = &_tailHandler<Profile, Mnemonic::Eq_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_I)] = &_tailHandler<Profile, Mnemonic::Eq_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_V)] = &_tailHandler<Profile, Mnemonic::Eq_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_R)] = &_tailHandler<Profile, Mnemonic::Eq_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_A)] = &_tailHandler<Profile, Mnemonic::Eq_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_I)] = &_tailHandler<Profile, Mnemonic::Eq_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_V)] = &_tailHandler<Profile, Mnemonic::Eq_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_R)] = &_tailHandler<Profile, Mnemonic::Eq_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_A)] = &_tailHandler<Profile, Mnemonic::Eq_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_I)] = &_tailHandler<Profile, Mnemonic::Eq_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_V)] = &_tailHandler<Profile, Mnemonic::Eq_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_R)] = &_tailHandler<Profile, Mnemonic::Neq_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_A)] = &_tailHandler<Profile, Mnemonic::Neq_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_I)] = &_tailHandler<Profile, Mnemonic::Neq_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_V)] = &_tailHandler<Profile, Mnemonic::Neq_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_R)] = &_tailHandler<Profile, Mnemonic::Neq_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_A)] = &_tailHandler<Profile, Mnemonic::Neq_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_I)] = &_tailHandler<Profile, Mnemonic::Neq_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_V)] = &_tailHandler<Profile, Mnemonic::Neq_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_R)] = &_tailHandler<Profile, Mnemonic::Neq_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_A)] = &_tailHandler<Profile, Mnemonic::Neq_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_I)] = &_tailHandler<Profile, Mnemonic::Neq_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_V)] = &_tailHandler<Profile, Mnemonic::Neq_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_R)] = &_tailHandler<Profile, Mnemonic::Lt_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_A)] = &_tailHandler<Profile, Mnemonic::Lt_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_I)] = &_tailHandler<Profile, Mnemonic::Lt_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_V)] = &_tailHandler<Profile, Mnemonic::Lt_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_R)] = &_tailHandler<Profile, Mnemonic::Lt_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_A)] = &_tailHandler<Profile, Mnemonic::Lt_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_I)] = &_tailHandler<Profile, Mnemonic::Lt_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_V)] = &_tailHandler<Profile, Mnemonic::Lt_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_R)] = &_tailHandler<Profile, Mnemonic::Lt_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_A)] = &_tailHandler<Profile, Mnemonic::Lt_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_I)] = &_tailHandler<Profile, Mnemonic::Lt_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_V)] = &_tailHandler<Profile, Mnemonic::Lt_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_R)] = &_tailHandler<Profile, Mnemonic::Bt_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_A)] = &_tailHandler<Profile, Mnemonic::Bt_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_I)] = &_tailHandler<Profile, Mnemonic::Bt_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_V)] = &_tailHandler<Profile, Mnemonic::Bt_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_R)] = &_tailHandler<Profile, Mnemonic::Bt_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_A)] = &_tailHandler<Profile, Mnemonic::Bt_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_I)] = &_tailHandler<Profile, Mnemonic::Bt_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_V)] = &_tailHandler<Profile, Mnemonic::Bt_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_R)] = &_tailHandler<Profile, Mnemonic::Bt_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_A)] = &_tailHandler<Profile, Mnemonic::Bt_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_I)] = &_tailHandler<Profile, Mnemonic::Bt_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_V)] = &_tailHandler<Profile, Mnemonic::Bt_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Not_R)] = &_tailHandler<Profile, Mnemonic::Not_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Not_A)] = &_tailHandler<Profile, Mnemonic::Not_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Not_I)] = &_tailHandler<Profile, Mnemonic::Not_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_R)] = &_tailHandler<Profile, Mnemonic::Test_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_A)] = &_tailHandler<Profile, Mnemonic::Test_R_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_I)] = &_tailHandler<Profile, Mnemonic::Test_R_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_V)] = &_tailHandler<Profile, Mnemonic::Test_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_R)] = &_tailHandler<Profile, Mnemonic::Test_A_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_A)] = &_tailHandler<Profile, Mnemonic::Test_A_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_I)] = &_tailHandler<Profile, Mnemonic::Test_A_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_V)] = &_tailHandler<Profile, Mnemonic::Test_A_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_R)] = &_tailHandler<Profile, Mnemonic::Test_I_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_A)] = &_tailHandler<Profile, Mnemonic::Test_I_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_I)] = &_tailHandler<Profile, Mnemonic::Test_I_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_V)] = &_tailHandler<Profile, Mnemonic::Test_I_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMov_R_R)] = &_tailHandler<Profile, Mnemonic::FpMov_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMov_R_V)] = &_tailHandler<Profile, Mnemonic::FpMov_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpAdd_R_R)] = &_tailHandler<Profile, Mnemonic::FpAdd_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpAdd_R_V)] = &_tailHandler<Profile, Mnemonic::FpAdd_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSub_R_R)] = &_tailHandler<Profile, Mnemonic::FpSub_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSub_R_V)] = &_tailHandler<Profile, Mnemonic::FpSub_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMul_R_R)] = &_tailHandler<Profile, Mnemonic::FpMul_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMul_R_V)] = &_tailHandler<Profile, Mnemonic::FpMul_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpDiv_R_R)] = &_tailHandler<Profile, Mnemonic::FpDiv_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpDiv_R_V)] = &_tailHandler<Profile, Mnemonic::FpDiv_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSign_R)] = &_tailHandler<Profile, Mnemonic::FpSign_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSign_V)] = &_tailHandler<Profile, Mnemonic::FpSign_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRound_R)] = &_tailHandler<Profile, Mnemonic::FpRound_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpFloor_R)] = &_tailHandler<Profile, Mnemonic::FpFloor_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCeil_R)] = &_tailHandler<Profile, Mnemonic::FpCeil_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_R_R)] = &_tailHandler<Profile, Mnemonic::FpTest_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_R_V)] = &_tailHandler<Profile, Mnemonic::FpTest_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_V_R)] = &_tailHandler<Profile, Mnemonic::FpTest_V_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_V_V)] = &_tailHandler<Profile, Mnemonic::FpTest_V_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMod_R_R)] = &_tailHandler<Profile, Mnemonic::FpMod_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMod_R_V)] = &_tailHandler<Profile, Mnemonic::FpMod_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpNan_R)] = &_tailHandler<Profile, Mnemonic::FpNan_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpInf_R)] = &_tailHandler<Profile, Mnemonic::FpInf_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPi_R)] = &_tailHandler<Profile, Mnemonic::FpPi_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpE_R)] = &_tailHandler<Profile, Mnemonic::FpE_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCstLn2_R)] = &_tailHandler<Profile, Mnemonic::FpCstLn2_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCstLn10_R)] = &_tailHandler<Profile, Mnemonic::FpCstLn10_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCstLog10_R)] = &_tailHandler<Profile, Mnemonic::FpCstLog10_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSin_R_R)] = &_tailHandler<Profile, Mnemonic::FpSin_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSin_R_V)] = &_tailHandler<Profile, Mnemonic::FpSin_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCos_R_R)] = &_tailHandler<Profile, Mnemonic::FpCos_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCos_R_V)] = &_tailHandler<Profile, Mnemonic::FpCos_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTan_R_R)] = &_tailHandler<Profile, Mnemonic::FpTan_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTan_R_V)] = &_tailHandler<Profile, Mnemonic::FpTan_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLn_R_R)] = &_tailHandler<Profile, Mnemonic::FpLn_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLn_R_V)] = &_tailHandler<Profile, Mnemonic::FpLn_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog2_R_R)] = &_tailHandler<Profile, Mnemonic::FpLog2_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog2_R_V)] = &_tailHandler<Profile, Mnemonic::FpLog2_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog10_R_R)] = &_tailHandler<Profile, Mnemonic::FpLog10_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog10_R_V)] = &_tailHandler<Profile, Mnemonic::FpLog10_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRoot_R)] = &_tailHandler<Profile, Mnemonic::FpRoot_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCsqrt_R)] = &_tailHandler<Profile, Mnemonic::FpCsqrt_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSq_R)] = &_tailHandler<Profile, Mnemonic::FpSq_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPow_R_R)] = &_tailHandler<Profile, Mnemonic::FpPow_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRoot_R_R)] = &_tailHandler<Profile, Mnemonic::FpRoot_R_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPow_R_V)] = &_tailHandler<Profile, Mnemonic::FpPow_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRoot_R_V)] = &_tailHandler<Profile, Mnemonic::FpRoot_R_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpExp_R)] = &_tailHandler<Profile, Mnemonic::FpExp_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPrint_R)] = &_tailHandler<Profile, Mnemonic::FpPrint_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPrint_V)] = &_tailHandler<Profile, Mnemonic::FpPrint_V>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvSignFlag_R)] = &_tailHandler<Profile, Mnemonic::MvSignFlag_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvSignFlag_A)] = &_tailHandler<Profile, Mnemonic::MvSignFlag_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvSignFlag_I)] = &_tailHandler<Profile, Mnemonic::MvSignFlag_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvInfFlag_R)] = &_tailHandler<Profile, Mnemonic::MvInfFlag_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvInfFlag_A)] = &_tailHandler<Profile, Mnemonic::MvInfFlag_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvInfFlag_I)] = &_tailHandler<Profile, Mnemonic::MvInfFlag_I>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvNanFlag_R)] = &_tailHandler<Profile, Mnemonic::MvNanFlag_R>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvNanFlag_A)] = &_tailHandler<Profile, Mnemonic::MvNanFlag_A>;
+		handlers[static_cast<uint32_t>(Mnemonic::MvNanFlag_I)] = &_tailHandler<Profile, Mnemonic::MvNanFlag_I>;
+
+		return handlers;
+	}();
+
+	//Same as VM::_execute, but instead of running the fetched instruction
+	//returns the handler that runs it
+	template <class Profile>
+	__forceinline VM::TailStep VM::_tailFetch() {
+		for (;;) {
+			DecodedInstruction* decoded;
+			if (precharged) {
+				decoded = _nextInBlock();
+			}
+			else {
+				if (!_countInstruction<Profile>())
+					return { nullptr, nullptr };
+
+				decoded = _fetchDecoded(instrPtr);
+				if (!decoded) {
+					auto memPtr = _checkExecutable(instrPtr);
+					if (!memPtr)
+						return { nullptr, nullptr };
+
+					auto nextInstr = Instruction::fromAddress(memPtr);
+					instrPtr += 3;
+					lastExecuted = nextInstr;
+					if (!_perform<Profile>(nextInstr))
+						return { nullptr, nullptr };
+					continue;
+				}
+
+				instrPtr += 3;
+				lastExecuted = &decoded->instr;
+				if (!_canPerformDecoded<Profile>(decoded))
+					return { nullptr, nullptr };
+
+#ifdef SBL_AOT
+				if (decoded->aot && aotModule) {
+					if (!_runAot(decoded))
+						return { nullptr, nullptr };
+					continue;
+				}
+#endif
+#ifdef SBL_JIT
+				if (_runJit<Profile>(decoded))
+					continue;
+#endif
+				_startBlock<Profile>(decoded);
+			}
+
+			if (decoded->fusion && _shouldFuse<Profile>(decoded))
+				return { &_tailFused<Profile>, decoded };
+
+			if (!Profile::verified && !(decoded->flags & DecodedInstruction::Resolved))
+				return { &_tailFallback<Profile>, decoded };
+
+			return { tailHandlers<Profile>[static_cast<uint32_t>(decoded->instr.mnemonic)], decoded };
+		}
+	}
+
+	template <class Profile, Mnemonic M>
+	__forceinline VM::TailStep VM::_tailRun(DecodedInstruction* decoded) {
+		Instruction* instr = &decoded->instr;
+
+		/*
+			Basic instructions
+		*/
+		if constexpr (M == Mnemonic::Nop) {
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Halt || M == Mnemonic::End) {
+			return { nullptr, nullptr };
+		}
+		else if constexpr (M == Mnemonic::Ret) {
+			instrPtr = _popStack();
+			--callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loop) {
+			_pushStack(loopPtr);
+			loopPtr = instrPtr;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Endloop) {
+			if (!registers[10]) {
+				loopPtr = _popStack();
+			}
+			else if (--registers[10]) {
+				instrPtr = loopPtr;
+			}
+			else {
+				loopPtr = _popStack();
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Push_R) {
+			_pushStack(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Push_A) {
+			_pushStack(_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Push_I) {
+			_pushStack(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Push_V) {
+			_pushStack(_tryRead(Value{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Push_All) {
+			for (size_t i = 0, j = registers.size(); i < j; ++i) {
+				_pushStack(registers[i]);
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Pop_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _popStack());
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Pop_A) {
+			_tryWrite(Address{ instr->arg1 }, _popStack());
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Pop_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _popStack());
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Pop_All) {
+			for (size_t i = registers.size() - 1, j = 0; i >= j; --i) {
+				registers[i] = _popStack();
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Clear_All) {
+			for (size_t i = 0, j = registers.size() - 4; i < j; ++i) {
+				registers[i] = 0;
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Inc_R) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Inc_A) {
+			_tryAdd(Address{ instr->arg1 }, 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Inc_I) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Dec_R) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, -1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Dec_A) {
+			_tryAdd(Address{ instr->arg1 }, -1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Dec_I) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, -1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Call_R) {
+			_pushStack(instrPtr);
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			++callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Call_A) {
+			_pushStack(instrPtr);
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			++callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Call_I) {
+			_pushStack(instrPtr);
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			++callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RCall_R) {
+			_pushStack(instrPtr);
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			++callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RCall_A) {
+			_pushStack(instrPtr);
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			++callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RCall_I) {
+			_pushStack(instrPtr);
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			++callDepth;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Read_R) {
+			std::cin >> _tryRead(ResolvedRegister{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Read_A) {
+			std::cin >> _tryRead(Address{ instr->arg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Read_I) {
+			std::cin >> _tryRead(ResolvedIndirect{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Readstr_A) {
+			std::cin >> reinterpret_cast<char*>(&_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Readstr_I) {
+			std::cin >> reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Print_R) {
+			std::cout << _tryRead(ResolvedRegister{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Print_A) {
+			std::cout << _tryRead(Address{ instr->arg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Print_I) {
+			std::cout << _tryRead(ResolvedIndirect{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Print_V) {
+			std::cout << _tryRead(Value{ instr->arg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintS_R) {
+			std::cout << static_cast<int32_t>(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintS_A) {
+			std::cout << static_cast<int32_t>(_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintS_I) {
+			std::cout << static_cast<int32_t>(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintS_V) {
+			std::cout << static_cast<int32_t>(_tryRead(Value{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintC_R) {
+			std::cout << static_cast<char>(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintC_A) {
+			std::cout << static_cast<char>(_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintC_I) {
+			std::cout << static_cast<char>(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::PrintC_V) {
+			std::cout << static_cast<char>(_tryRead(Value{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Printstr_A) {
+			std::cout << reinterpret_cast<char*>(&_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Printstr_I) {
+			std::cout << reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jmp_R) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jmp_A) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jmp_I) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jb_R || M == Mnemonic::Jnle_R) {
+			if (controlByte & TestBigger) {
+				instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jb_A || M == Mnemonic::Jnle_A) {
+			if (controlByte & TestBigger) {
+				instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jb_I || M == Mnemonic::Jnle_I) {
+			if (controlByte & TestBigger) {
+				instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnb_R || M == Mnemonic::Jle_R) {
+			if (controlByte & TestSmallerEqual) {
+				instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnb_A || M == Mnemonic::Jle_A) {
+			if (controlByte & TestSmallerEqual) {
+				instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnb_I || M == Mnemonic::Jle_I) {
+			if (controlByte & TestSmallerEqual) {
+				instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jbe_R || M == Mnemonic::Jnl_R) {
+			if (controlByte & TestBiggerEqual) {
+				instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jbe_A || M == Mnemonic::Jnl_A) {
+			if (controlByte & TestBiggerEqual) {
+				instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jbe_I || M == Mnemonic::Jnl_I) {
+			if (controlByte & TestBiggerEqual) {
+				instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnbe_R || M == Mnemonic::Jl_R) {
+			if (controlByte & TestSmaller) {
+				instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnbe_A || M == Mnemonic::Jl_A) {
+			if (controlByte & TestSmaller) {
+				instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnbe_I || M == Mnemonic::Jl_I) {
+			if (controlByte & TestSmaller) {
+				instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jz_R || M == Mnemonic::Je_R) {
+			if (controlByte & TestEqual) {
+				instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jz_A || M == Mnemonic::Je_A) {
+			if (controlByte & TestEqual) {
+				instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jz_I || M == Mnemonic::Je_I) {
+			if (controlByte & TestEqual) {
+				instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnz_R || M == Mnemonic::Jne_R) {
+			if (controlByte & TestUnequal) {
+				instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnz_A || M == Mnemonic::Jne_A) {
+			if (controlByte & TestUnequal) {
+				instrPtr = _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Jnz_I || M == Mnemonic::Jne_I) {
+			if (controlByte & TestUnequal) {
+				instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJmp_R) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJmp_A) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJmp_I) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJb_R || M == Mnemonic::RJnle_R) {
+			if (controlByte & TestBigger) {
+				instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJb_A || M == Mnemonic::RJnle_A) {
+			if (controlByte & TestBigger) {
+				instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJb_I || M == Mnemonic::RJnle_I) {
+			if (controlByte & TestBigger) {
+				instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnb_R || M == Mnemonic::RJle_R) {
+			if (controlByte & TestSmallerEqual) {
+				instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnb_A || M == Mnemonic::RJle_A) {
+			if (controlByte & TestSmallerEqual) {
+				instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnb_I || M == Mnemonic::RJle_I) {
+			if (controlByte & TestSmallerEqual) {
+				instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJbe_R || M == Mnemonic::RJnl_R) {
+			if (controlByte & TestBiggerEqual) {
+				instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJbe_A || M == Mnemonic::RJnl_A) {
+			if (controlByte & TestBiggerEqual) {
+				instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJbe_I || M == Mnemonic::RJnl_I) {
+			if (controlByte & TestBiggerEqual) {
+				instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnbe_R || M == Mnemonic::RJl_R) {
+			if (controlByte & TestSmaller) {
+				instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnbe_A || M == Mnemonic::RJl_A) {
+			if (controlByte & TestSmaller) {
+				instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnbe_I || M == Mnemonic::RJl_I) {
+			if (controlByte & TestSmaller) {
+				instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJz_R || M == Mnemonic::RJe_R) {
+			if (controlByte & TestEqual) {
+				instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJz_A || M == Mnemonic::RJe_A) {
+			if (controlByte & TestEqual) {
+				instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJz_I || M == Mnemonic::RJe_I) {
+			if (controlByte & TestEqual) {
+				instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnz_R || M == Mnemonic::RJne_R) {
+			if (controlByte & TestUnequal) {
+				instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnz_A || M == Mnemonic::RJne_A) {
+			if (controlByte & TestUnequal) {
+				instrPtr += _tryReadDeref(Address{ instr->arg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RJnz_I || M == Mnemonic::RJne_I) {
+			if (controlByte & TestUnequal) {
+				instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Time_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, static_cast<uint32_t>(getTime(startExecTime)));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Time_A) {
+			_tryWrite(Address{ instr->arg1 }, static_cast<uint32_t>(getTime(startExecTime)));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Time_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, static_cast<uint32_t>(getTime(startExecTime)));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Time64_R) {
+		{
+			auto& v1 = _tryRead(ResolvedRegister{ decoded->regArg1 });
+			auto& v2 = _tryRead(Register{ instr->arg1 + 1 });
+			_writeTime(getTime(startExecTime), v1, v2);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Time64_A) {
+		{
+			auto& v1 = _tryRead(Address{ instr->arg1 });
+			auto& v2 = _tryRead(Address{ instr->arg1 + 1 });
+			_writeTime(getTime(startExecTime), v1, v2);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Time64_I) {
+		{
+			auto& v1 = _tryRead(ResolvedIndirect{ decoded->regArg1 });
+			auto& v2 = _tryRead(Indirect{ instr->arg1 + 1 });
+			_writeTime(getTime(startExecTime), v1, v2);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ICount_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, static_cast<uint32_t>(instrCount));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ICount_A) {
+			_tryWrite(Address{ instr->arg1 }, static_cast<uint32_t>(instrCount));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ICount_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, static_cast<uint32_t>(instrCount));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ICount64_R) {
+		{
+			auto& v1 = _tryRead(ResolvedRegister{ decoded->regArg1 });
+			auto& v2 = _tryRead(Register{ instr->arg1 + 1 });
+			_writeTime(instrCount, v1, v2);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ICount64_A) {
+		{
+			auto& v1 = _tryRead(Address{ instr->arg1 });
+			auto& v2 = _tryRead(Address{ instr->arg1 + 1 });
+			_writeTime(instrCount, v1, v2);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ICount64_I) {
+		{
+			auto& v1 = _tryRead(ResolvedIndirect{ decoded->regArg1 });
+			auto& v2 = _tryRead(Indirect{ instr->arg1 + 1 });
+			_writeTime(instrCount, v1, v2);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ExecInstr_A) {
+		{
+			auto derefed = _tryReadDeref(Address{ instr->arg1 });
+			if (!_checkExecutable(derefed))
+				return { nullptr, nullptr };
+			auto memPtr = memory.memory.tryAccess(derefed, SegmentAccessType::Executable);
+			if (!memPtr) {
+				error = { ErrorCode::UnallowedSegmentExec, instrPtr };
+				running = false;
+				return { nullptr, nullptr };
+			}
+			if (!_perform(Instruction::fromAddress(memPtr)))
+				return { nullptr, nullptr };
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ExecInstr_I) {
+		{
+			auto derefed = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+			if (!_checkExecutable(derefed))
+				return { nullptr, nullptr };
+			auto memPtr = memory.memory.tryAccess(derefed, SegmentAccessType::Executable);
+			if (!memPtr) {
+				error = { ErrorCode::UnallowedSegmentExec, instrPtr };
+				running = false;
+				return { nullptr, nullptr };
+			}
+			if (!_perform(Instruction::fromAddress(memPtr)))
+				return { nullptr, nullptr };
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_R_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_R_A) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_R_I) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_R_V) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_A_R) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_A_A) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_A_I) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_A_V) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_I_R) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_I_A) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_I_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mov_I_V) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_R_R || M == Mnemonic::Movz_R_R) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_R_A || M == Mnemonic::Movz_R_A) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_R_I || M == Mnemonic::Movz_R_I) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_R_V || M == Mnemonic::Movz_R_V) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_A_R || M == Mnemonic::Movz_A_R) {
+			if (controlByte & TestEqual) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_A_A || M == Mnemonic::Movz_A_A) {
+			if (controlByte & TestEqual) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_A_I || M == Mnemonic::Movz_A_I) {
+			if (controlByte & TestEqual) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_A_V || M == Mnemonic::Movz_A_V) {
+			if (controlByte & TestEqual) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_I_R || M == Mnemonic::Movz_I_R) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_I_A || M == Mnemonic::Movz_I_A) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_I_I || M == Mnemonic::Movz_I_I) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Move_I_V || M == Mnemonic::Movz_I_V) {
+			if (controlByte & TestEqual) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_R_R || M == Mnemonic::Movnz_R_R) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_R_A || M == Mnemonic::Movnz_R_A) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_R_I || M == Mnemonic::Movnz_R_I) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_R_V || M == Mnemonic::Movnz_R_V) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_A_R || M == Mnemonic::Movnz_A_R) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_A_A || M == Mnemonic::Movnz_A_A) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_A_I || M == Mnemonic::Movnz_A_I) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_A_V || M == Mnemonic::Movnz_A_V) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_I_R || M == Mnemonic::Movnz_I_R) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_I_A || M == Mnemonic::Movnz_I_A) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_I_I || M == Mnemonic::Movnz_I_I) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Movne_I_V || M == Mnemonic::Movnz_I_V) {
+			if (controlByte & TestUnequal) {
+				_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Laddr_R_A) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryReadAddr(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Laddr_R_I) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryReadAddr(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Laddr_A_A) {
+			_tryWrite(Address{ instr->arg1 }, _tryReadAddr(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Laddr_A_I) {
+			_tryWrite(Address{ instr->arg1 }, _tryReadAddr(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Laddr_I_A) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryReadAddr(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Laddr_I_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryReadAddr(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loadload_R_A) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ _tryRead(Address{ instr->arg2 }) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loadload_R_I) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg2 }) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loadload_A_A) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ _tryRead(Address{ instr->arg2 }) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loadload_A_I) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg2 }) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loadload_I_A) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ _tryRead(Address{ instr->arg2 }) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Loadload_I_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg2 }) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_R_R) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_R_A) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_R_I) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_R_V) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_A_R) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_A_A) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_A_I) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_A_V) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_I_R) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_I_A) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_I_I) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_I_V) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_V_R) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_V_A) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_V_I) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Vcall_V_V) {
+			_pushStack(instrPtr);
+			instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_R_R) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_R_A) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_R_I) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_R_V) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_A_R) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_A_A) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_A_I) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_A_V) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_I_R) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_I_A) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_I_I) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_I_V) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_V_R) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_V_A) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_V_I) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RVcall_V_V) {
+			_pushStack(instrPtr);
+			instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::NtvCall_R) {
+			_doNativeCall(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::NtvCall_A) {
+			_doNativeCall(_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::NtvCall_I) {
+			_doNativeCall(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::NtvCall_V) {
+			_doNativeCall(_tryRead(Value{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetNtvId_R_A) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(Address{ instr->arg2 }))));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetNtvId_R_I) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg2 }))));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetNtvId_A_A) {
+			_tryWrite(Address{ instr->arg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(Address{ instr->arg2 }))));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetNtvId_A_I) {
+			_tryWrite(Address{ instr->arg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg2 }))));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetNtvId_I_A) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(Address{ instr->arg2 }))));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetNtvId_I_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg2 }))));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_R_R) {
+			std::swap(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_R_A) {
+			std::swap(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_R_I) {
+			std::swap(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_A_R) {
+			std::swap(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_A_A) {
+			std::swap(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_A_I) {
+			std::swap(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_I_R) {
+			std::swap(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_I_A) {
+			std::swap(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xchg_I_I) {
+			std::swap(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::ClrCb) {
+			controlByte = 0;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Hotpatch_A_A) {
+			_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Hotpatch_A_I) {
+			_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Hotpatch_I_A) {
+			_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Hotpatch_I_I) {
+			_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RHotpatch_A_A) {
+			_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, Address{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RHotpatch_A_I) {
+			_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, Address{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RHotpatch_I_A) {
+			_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, ResolvedIndirect{ decoded->regArg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::RHotpatch_I_I) {
+			_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, ResolvedIndirect{ decoded->regArg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::EnableExt_R) {
+			extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg1 }))].enabled = true;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::EnableExt_A) {
+			extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg1 }))].enabled = true;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::EnableExt_I) {
+			extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg1 }))].enabled = true;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::EnableExt_V) {
+			extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg1 }))].enabled = true;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::DisableExt_R) {
+			extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg1 }))].enabled = false;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::DisableExt_A) {
+			extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg1 }))].enabled = false;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::DisableExt_I) {
+			extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg1 }))].enabled = false;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::DisableExt_V) {
+			extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg1 }))].enabled = false;
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_R_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_R_A) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_R_I) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_R_V) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_A_R) {
+			_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_A_A) {
+			_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_A_I) {
+			_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_A_V) {
+			_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_I_R) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_I_A) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_I_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::IsExtEnabled_I_V) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg2 }))].enabled);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_R_R) {
+			_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_R_A) {
+			_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_R_I) {
+			_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_R_V) {
+			_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_A_R) {
+			_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_A_A) {
+			_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_A_I) {
+			_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_A_V) {
+			_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_I_R) {
+			_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_I_A) {
+			_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_I_I) {
+			_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_I_V) {
+			_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_V_R) {
+			_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_V_A) {
+			_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_V_I) {
+			_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::SetSegmntAccs_V_V) {
+			_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_R_R) {
+			_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_R_A) {
+			_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_R_I) {
+			_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_R_V) {
+			_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_A_R) {
+			_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_A_A) {
+			_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_A_I) {
+			_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_A_V) {
+			_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_I_R) {
+			_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_I_A) {
+			_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_I_I) {
+			_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::GetSegmntAccs_I_V) {
+			_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		/*
+			Arithmetic instructions
+		*/
+		else if constexpr (M == Mnemonic::Add_R_R) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_R_I) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_R_A) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_R_V) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_I_R) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_I_I) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_I_A) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_I_V) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_A_R) {
+			_tryAdd(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_A_I) {
+			_tryAdd(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_A_A) {
+			_tryAdd(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Add_A_V) {
+			_tryAdd(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_R_R) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(ResolvedRegister{ decoded->regArg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_R_A) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(Address{ instr->arg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_R_I) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(ResolvedIndirect{ decoded->regArg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_R_V) {
+			_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(Value{ instr->arg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_A_R) {
+			_tryAdd(Address{ instr->arg1 }, ~_tryRead(ResolvedRegister{ decoded->regArg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_A_A) {
+			_tryAdd(Address{ instr->arg1 }, ~_tryRead(Address{ instr->arg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_A_I) {
+			_tryAdd(Address{ instr->arg1 }, ~_tryRead(ResolvedIndirect{ decoded->regArg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_A_V) {
+			_tryAdd(Address{ instr->arg1 }, ~_tryRead(Value{ instr->arg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_I_R) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(ResolvedRegister{ decoded->regArg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_I_A) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(Address{ instr->arg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_I_I) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(ResolvedIndirect{ decoded->regArg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Sub_I_V) {
+			_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(Value{ instr->arg2 }) + 1);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mul_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Div_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Mod_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lsh_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rlsh_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rsh_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Rrsh_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		/*
+			Logical instructions
+		*/
+		else if constexpr (M == Mnemonic::And_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::And_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Or_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_R_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_R_A) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_R_I) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_R_V) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_A_R) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_A_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_A_I) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_A_V) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_I_R) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_I_A) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_I_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Xor_I_V) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_R_R) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(ResolvedRegister{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_R_A) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(Address{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_R_I) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_R_V) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(Value{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_A_R) {
+			setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(ResolvedRegister{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_A_A) {
+			setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(Address{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_A_I) {
+			setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_A_V) {
+			setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(Value{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_I_R) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(ResolvedRegister{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_I_A) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(Address{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_I_I) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Eq_I_V) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(Value{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_R_R) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(ResolvedRegister{ decoded->regArg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_R_A) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(Address{ instr->arg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_R_I) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_R_V) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(Value{ instr->arg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_A_R) {
+			setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(ResolvedRegister{ decoded->regArg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_A_A) {
+			setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(Address{ instr->arg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_A_I) {
+			setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_A_V) {
+			setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(Value{ instr->arg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_I_R) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(ResolvedRegister{ decoded->regArg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_I_A) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(Address{ instr->arg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_I_I) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Neq_I_V) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(Value{ instr->arg2 }), TestUnequal);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_R_R) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(ResolvedRegister{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_R_A) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(Address{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_R_I) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_R_V) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(Value{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_A_R) {
+			setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(ResolvedRegister{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_A_A) {
+			setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(Address{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_A_I) {
+			setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_A_V) {
+			setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(Value{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_I_R) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(ResolvedRegister{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_I_A) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(Address{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_I_I) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Lt_I_V) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(Value{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_R_R) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(ResolvedRegister{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_R_A) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(Address{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_R_I) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_R_V) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(Value{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_A_R) {
+			setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(ResolvedRegister{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_A_A) {
+			setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(Address{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_A_I) {
+			setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_A_V) {
+			setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(Value{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_I_R) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(ResolvedRegister{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_I_A) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(Address{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_I_I) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Bt_I_V) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(Value{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Not_R) {
+			_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+			_forceWrite(ResolvedRegister{ decoded->regArg1 }, ~_forceRead(ResolvedRegister{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Not_A) {
+			_assertReadWrite(Address{ instr->arg1 });
+			_forceWrite(Address{ instr->arg1 }, ~_forceRead(Address{ instr->arg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Not_I) {
+			_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+			_forceWrite(ResolvedIndirect{ decoded->regArg1 }, ~_forceRead(ResolvedIndirect{ decoded->regArg1 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_R_R) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_R_A) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_R_I) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_R_V) {
+			setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_A_R) {
+			setControl(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_A_A) {
+			setControl(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_A_I) {
+			setControl(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_A_V) {
+			setControl(_tryRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_I_R) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_I_A) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_I_I) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::Test_I_V) {
+			setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		/*
+			Floating point instructions
+		*/
+		else if constexpr (M == Mnemonic::FpMov_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpMov_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpAdd_R_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) + _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpAdd_R_V) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) + _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSub_R_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) - _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSub_R_V) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) - _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpMul_R_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) * _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpMul_R_V) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) * _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpDiv_R_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) / _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpDiv_R_V) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) / _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSign_R) {
+		{
+			auto f = _tryRead(FpRegister{ instr->arg1 });
+			if (f < 0) {
+				controlByte |= TestFloatNegative;
+			}
+			else if (f > 0) {
+				controlByte |= TestFloatPositive;
+			}
+			else {
+				controlByte |= TestFloatZero;
+			}
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSign_V) {
+		{
+			auto f = _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) });
+			if (f < 0) {
+				controlByte |= TestFloatNegative;
+			}
+			else if (f > 0) {
+				controlByte |= TestFloatPositive;
+			}
+			else {
+				controlByte |= TestFloatZero;
+			}
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpRound_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, std::round(_forceRead(FpRegister{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpFloor_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, std::floor(_forceRead(FpRegister{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCeil_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, std::ceil(_forceRead(FpRegister{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpTest_R_R) {
+			setFloatControl(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpTest_R_V) {
+			setFloatControl(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpTest_V_R) {
+			setFloatControl(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) }), _tryRead(FpRegister{ instr->arg2 }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpTest_V_V) {
+			setFloatControl(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpMod_R_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_tryWrite(FpRegister{ instr->arg1 }, std::fmod(_forceRead(FpRegister{ instr->arg1 }), _tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpMod_R_V) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_tryWrite(FpRegister{ instr->arg1 }, std::fmod(_forceRead(FpRegister{ instr->arg1 }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpNan_R) {
+			if (std::isnan(_tryRead(FpRegister{ instr->arg1 }))) {
+				controlByte |= TestFloatNan;
+			}
+			else {
+				controlByte &= ~TestFloatNan;
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpInf_R) {
+			if (std::isinf(_tryRead(FpRegister{ instr->arg1 }))) {
+				controlByte |= TestFloatInf;
+			}
+			else {
+				controlByte &= ~TestFloatInf;
+			}
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpPi_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, 3.1415926536f);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpE_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, 2.7182818285f);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCstLn2_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, 0.6931471806f);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCstLn10_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, 2.302585093f);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCstLog10_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, 0.3010299957f);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSin_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::sin(_tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSin_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::sin(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCos_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::cos(_tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCos_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::cos(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpTan_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::tan(_tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpTan_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::tan(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpLn_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::log(_tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpLn_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::log(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpLog2_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::log2(_tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpLog2_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::log2(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpLog10_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::log10(_tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpLog10_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::log10(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpRoot_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::sqrt(_tryRead(FpRegister{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpCsqrt_R) {
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, std::cbrt(_forceRead(FpRegister{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpSq_R) {
+		{
+			_assertReadWrite(FpRegister{ instr->arg1 });
+			auto v = _forceRead(FpRegister{ instr->arg1 });
+			_forceWrite(FpRegister{ instr->arg1 }, v * v);
+		}
+		return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpPow_R_R || M == Mnemonic::FpRoot_R_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::pow(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpRegister{ instr->arg2 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpPow_R_V || M == Mnemonic::FpRoot_R_V) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::pow(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpExp_R) {
+			_tryWrite(FpRegister{ instr->arg1 }, std::exp(_tryRead(FpRegister{ instr->arg1 })));
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpPrint_R) {
+			std::cout << _tryRead(FpRegister{ instr->arg1 });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::FpPrint_V) {
+			std::cout << _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) });
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvSignFlag_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 6);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvSignFlag_A) {
+			_tryWrite(Address{ instr->arg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 6);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvSignFlag_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 6);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvInfFlag_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 9);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvInfFlag_A) {
+			_tryWrite(Address{ instr->arg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 9);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvInfFlag_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 9);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvNanFlag_R) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 10);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvNanFlag_A) {
+			_tryWrite(Address{ instr->arg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 10);
+			return _tailFetch<Profile>();
+		}
+		else if constexpr (M == Mnemonic::MvNanFlag_I) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 10);
+			return _tailFetch<Profile>();
+		}
+	}
+
+//Ends a handler, vm has to be the running VM
+#define SBL_TAIL_CALL_NEXT(next)												\
+		do {																	\
+			if (!next.handler)													\
+				return;															\
+			SBL_MUSTTAIL return next.handler(vm, next.decoded);					\
+		} while (false)
+
+	template <class Profile, Mnemonic M>
+	void VM::_tailHandler(VM* vm, DecodedInstruction* decoded) {
+		auto next = vm->_tailRun<Profile, M>(decoded);
+		SBL_TAIL_CALL_NEXT(next);
+	}
+
+	template <class Profile>
+	void VM::_tailFused(VM* vm, DecodedInstruction* decoded) {
+		if (!vm->_performFused(decoded))
+			return;
+		auto next = vm->_tailFetch<Profile>();
+		SBL_TAIL_CALL_NEXT(next);
+	}
+
+	template <class Profile>
+	void VM::_tailFallback(VM* vm, DecodedInstruction* decoded) {
+		auto instr = &decoded->instr;
+		if (!(vm->*runners[static_cast<uint32_t>(instr->mnemonic) / 128])(instr))
+			return;
+		auto next = vm->_tailFetch<Profile>();
+		SBL_TAIL_CALL_NEXT(next);
+	}
+
+#undef SBL_TAIL_CALL_NEXT
+
+	template <class Profile>
+	void VM::_loopTail() {
+		auto first = _tailFetch<Profile>();
+		if (first.handler)
+			first.handler(this, first.decoded);
+	}
+
+	template void VM::_loopTail<FullProfile>();
+	template void VM::_loopTail<NoPrivilegeProfile>();
+	template void VM::_loopTail<NoInterruptProfile>();
+	template void VM::_loopTail<MinimalProfile>();
+	template void VM::_loopTail<VerifiedOf<FullProfile>>();
+	template void VM::_loopTail<VerifiedOf<NoPrivilegeProfile>>();
+	template void VM::_loopTail<VerifiedOf<NoInterruptProfile>>();
+	template void VM::_loopTail<VerifiedOf<MinimalProfile>>();
+}	//sbl::vm
+
+#endif	//SBL_TAIL_CALL
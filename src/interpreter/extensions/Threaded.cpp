@@ -0,0 +1,3285 @@
+#include <cmath>
+#include "../VM.hpp"
+#include "../../common/Instruction.hpp"
+
+#ifdef SBL_DIRECT_THREADED
+
+namespace sbl::vm {
+	/*
+		Direct threaded dispatch engine, enabled by SBL_DIRECT_THREADED(see Config.hpp).
+
+		Every mnemonic of the Basic, Arithmetic, Logical and Floating point chunks has
+		its own handler label, and every handler ends with its own copy of the dispatch,
+		which jumps straight into the handler of the next instruction through
+		the handlers table. This removes the call through runners[] and the jump through
+		the switch of the chunk, and gives the branch predictor a separate indirect jump
+		per handler to learn from.
+
+		The handlers are the bodies of the switches from Basic.cpp, Arithmetic.cpp, Logical.cpp
+		and Float.cpp, and have to be kept in sync with them. Allocation, Interrupt and Privilege
+		instructions are rare enough that they go through runners[] from the fallback handler.
+		Unassigned mnemonics of a valid chunk go there too, so they keep behaving exactly
+		like they do in the switch based engine.
+
+		Instructions come from the decoded segments(see VM::_fetchDecoded), the handlers
+		use the registers resolved during decoding instead of validating the register ids
+		on every execution. Instructions whose registers failed to resolve go through
+		the fallback, where the checked accesses raise the error. Verified programs
+		(see Verifier.hpp) only ever fetch decoded instructions with resolved registers,
+		the rest is decoded again here and sent to the fallback.
+		Fused groups of instructions(see Fusion.hpp) are run by VM::_performFused.
+		Instructions inside of a basic block(see VM::_startBlock) skip straight
+		to their handler, and blocks compiled by the JIT(see Jit.hpp) run their
+		machine code instead.
+
+		While a basic block runs, its position(instrPtr, lastExecuted, blockNext and precharged)
+		is kept in locals of the engine instead of the members. Handlers that only work
+		with resolved registers and values can neither raise nor observe that state, so
+		they run on the locals alone. Every other handler, the fused groups and the fallback
+		write the locals back with SBL_SYNC first, which covers native calls, interrupts,
+		State accessors, errors and leaving the loop. The last instruction of a block
+		gets written back when it is fetched, so the dispatch outside of blocks, and
+		the instructions ending a block by moving instrPtr, always see the members.
+		The engine is instantiated once per feature profile(see Profile.hpp).
+	*/
+	template <class Profile>
+	void VM::_loopThreaded() {
+		void* handlers[static_cast<uint32_t>(Mnemonic::TotalCount)];
+
+		for (auto& handler : handlers)
+			handler = &&op_Fallback;
+
+		handlers[static_cast<uint32_t>(Mnemonic::Nop)] = &&op_Nop;
+		handlers[static_cast<uint32_t>(Mnemonic::Halt)] = &&op_Halt;
+		handlers[static_cast<uint32_t>(Mnemonic::End)] = &&op_End;
+		handlers[static_cast<uint32_t>(Mnemonic::Ret)] = &&op_Ret;
+		handlers[static_cast<uint32_t>(Mnemonic::Loop)] = &&op_Loop;
+		handlers[static_cast<uint32_t>(Mnemonic::Endloop)] = &&op_Endloop;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_R)] = &&op_Push_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_A)] = &&op_Push_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_I)] = &&op_Push_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_V)] = &&op_Push_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Push_All)] = &&op_Push_All;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_R)] = &&op_Pop_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_A)] = &&op_Pop_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_I)] = &&op_Pop_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Pop_All)] = &&op_Pop_All;
+		handlers[static_cast<uint32_t>(Mnemonic::Clear_All)] = &&op_Clear_All;
+		handlers[static_cast<uint32_t>(Mnemonic::Inc_R)] = &&op_Inc_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Inc_A)] = &&op_Inc_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Inc_I)] = &&op_Inc_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Dec_R)] = &&op_Dec_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Dec_A)] = &&op_Dec_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Dec_I)] = &&op_Dec_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Call_R)] = &&op_Call_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Call_A)] = &&op_Call_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Call_I)] = &&op_Call_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RCall_R)] = &&op_RCall_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RCall_A)] = &&op_RCall_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RCall_I)] = &&op_RCall_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Read_R)] = &&op_Read_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Read_A)] = &&op_Read_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Read_I)] = &&op_Read_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Readstr_A)] = &&op_Readstr_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Readstr_I)] = &&op_Readstr_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_R)] = &&op_Print_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_A)] = &&op_Print_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_I)] = &&op_Print_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Print_V)] = &&op_Print_V;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_R)] = &&op_PrintS_R;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_A)] = &&op_PrintS_A;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_I)] = &&op_PrintS_I;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintS_V)] = &&op_PrintS_V;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_R)] = &&op_PrintC_R;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_A)] = &&op_PrintC_A;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_I)] = &&op_PrintC_I;
+		handlers[static_cast<uint32_t>(Mnemonic::PrintC_V)] = &&op_PrintC_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Printstr_A)] = &&op_Printstr_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Printstr_I)] = &&op_Printstr_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jmp_R)] = &&op_Jmp_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jmp_A)] = &&op_Jmp_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jmp_I)] = &&op_Jmp_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jb_R)] = &&op_Jb_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnle_R)] = &&op_Jnle_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jb_A)] = &&op_Jb_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnle_A)] = &&op_Jnle_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jb_I)] = &&op_Jb_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnle_I)] = &&op_Jnle_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnb_R)] = &&op_Jnb_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jle_R)] = &&op_Jle_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnb_A)] = &&op_Jnb_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jle_A)] = &&op_Jle_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnb_I)] = &&op_Jnb_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jle_I)] = &&op_Jle_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jbe_R)] = &&op_Jbe_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnl_R)] = &&op_Jnl_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jbe_A)] = &&op_Jbe_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnl_A)] = &&op_Jnl_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jbe_I)] = &&op_Jbe_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnl_I)] = &&op_Jnl_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnbe_R)] = &&op_Jnbe_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jl_R)] = &&op_Jl_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnbe_A)] = &&op_Jnbe_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jl_A)] = &&op_Jl_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnbe_I)] = &&op_Jnbe_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jl_I)] = &&op_Jl_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jz_R)] = &&op_Jz_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Je_R)] = &&op_Je_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jz_A)] = &&op_Jz_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Je_A)] = &&op_Je_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jz_I)] = &&op_Jz_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Je_I)] = &&op_Je_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnz_R)] = &&op_Jnz_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jne_R)] = &&op_Jne_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnz_A)] = &&op_Jnz_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jne_A)] = &&op_Jne_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Jnz_I)] = &&op_Jnz_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Jne_I)] = &&op_Jne_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJmp_R)] = &&op_RJmp_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJmp_A)] = &&op_RJmp_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJmp_I)] = &&op_RJmp_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJb_R)] = &&op_RJb_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnle_R)] = &&op_RJnle_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJb_A)] = &&op_RJb_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnle_A)] = &&op_RJnle_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJb_I)] = &&op_RJb_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnle_I)] = &&op_RJnle_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnb_R)] = &&op_RJnb_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJle_R)] = &&op_RJle_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnb_A)] = &&op_RJnb_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJle_A)] = &&op_RJle_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnb_I)] = &&op_RJnb_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJle_I)] = &&op_RJle_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJbe_R)] = &&op_RJbe_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnl_R)] = &&op_RJnl_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJbe_A)] = &&op_RJbe_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnl_A)] = &&op_RJnl_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJbe_I)] = &&op_RJbe_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnl_I)] = &&op_RJnl_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnbe_R)] = &&op_RJnbe_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJl_R)] = &&op_RJl_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnbe_A)] = &&op_RJnbe_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJl_A)] = &&op_RJl_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnbe_I)] = &&op_RJnbe_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJl_I)] = &&op_RJl_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJz_R)] = &&op_RJz_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJe_R)] = &&op_RJe_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJz_A)] = &&op_RJz_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJe_A)] = &&op_RJe_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJz_I)] = &&op_RJz_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJe_I)] = &&op_RJe_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnz_R)] = &&op_RJnz_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJne_R)] = &&op_RJne_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnz_A)] = &&op_RJnz_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJne_A)] = &&op_RJne_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RJnz_I)] = &&op_RJnz_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RJne_I)] = &&op_RJne_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Time_R)] = &&op_Time_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Time_A)] = &&op_Time_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Time_I)] = &&op_Time_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Time64_R)] = &&op_Time64_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Time64_A)] = &&op_Time64_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Time64_I)] = &&op_Time64_I;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount_R)] = &&op_ICount_R;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount_A)] = &&op_ICount_A;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount_I)] = &&op_ICount_I;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount64_R)] = &&op_ICount64_R;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount64_A)] = &&op_ICount64_A;
+		handlers[static_cast<uint32_t>(Mnemonic::ICount64_I)] = &&op_ICount64_I;
+		handlers[static_cast<uint32_t>(Mnemonic::ExecInstr_A)] = &&op_ExecInstr_A;
+		handlers[static_cast<uint32_t>(Mnemonic::ExecInstr_I)] = &&op_ExecInstr_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_R)] = &&op_Mov_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_A)] = &&op_Mov_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_I)] = &&op_Mov_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_R_V)] = &&op_Mov_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_R)] = &&op_Mov_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_A)] = &&op_Mov_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_I)] = &&op_Mov_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_A_V)] = &&op_Mov_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_R)] = &&op_Mov_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_A)] = &&op_Mov_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_I)] = &&op_Mov_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mov_I_V)] = &&op_Mov_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_R)] = &&op_Move_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_R)] = &&op_Movz_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_A)] = &&op_Move_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_A)] = &&op_Movz_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_I)] = &&op_Move_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_I)] = &&op_Movz_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_R_V)] = &&op_Move_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_R_V)] = &&op_Movz_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_R)] = &&op_Move_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_R)] = &&op_Movz_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_A)] = &&op_Move_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_A)] = &&op_Movz_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_I)] = &&op_Move_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_I)] = &&op_Movz_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_A_V)] = &&op_Move_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_A_V)] = &&op_Movz_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_R)] = &&op_Move_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_R)] = &&op_Movz_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_A)] = &&op_Move_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_A)] = &&op_Movz_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_I)] = &&op_Move_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_I)] = &&op_Movz_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Move_I_V)] = &&op_Move_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movz_I_V)] = &&op_Movz_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_R)] = &&op_Movne_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_R)] = &&op_Movnz_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_A)] = &&op_Movne_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_A)] = &&op_Movnz_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_I)] = &&op_Movne_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_I)] = &&op_Movnz_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_R_V)] = &&op_Movne_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_R_V)] = &&op_Movnz_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_R)] = &&op_Movne_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_R)] = &&op_Movnz_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_A)] = &&op_Movne_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_A)] = &&op_Movnz_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_I)] = &&op_Movne_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_I)] = &&op_Movnz_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_A_V)] = &&op_Movne_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_A_V)] = &&op_Movnz_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_R)] = &&op_Movne_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_R)] = &&op_Movnz_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_A)] = &&op_Movne_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_A)] = &&op_Movnz_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_I)] = &&op_Movne_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_I)] = &&op_Movnz_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Movne_I_V)] = &&op_Movne_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Movnz_I_V)] = &&op_Movnz_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_R_A)] = &&op_Laddr_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_R_I)] = &&op_Laddr_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_A_A)] = &&op_Laddr_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_A_I)] = &&op_Laddr_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_I_A)] = &&op_Laddr_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Laddr_I_I)] = &&op_Laddr_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_R_A)] = &&op_Loadload_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_R_I)] = &&op_Loadload_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_A_A)] = &&op_Loadload_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_A_I)] = &&op_Loadload_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_I_A)] = &&op_Loadload_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Loadload_I_I)] = &&op_Loadload_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_R)] = &&op_Vcall_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_A)] = &&op_Vcall_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_I)] = &&op_Vcall_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_R_V)] = &&op_Vcall_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_R)] = &&op_Vcall_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_A)] = &&op_Vcall_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_I)] = &&op_Vcall_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_A_V)] = &&op_Vcall_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_R)] = &&op_Vcall_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_A)] = &&op_Vcall_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_I)] = &&op_Vcall_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_I_V)] = &&op_Vcall_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_R)] = &&op_Vcall_V_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_A)] = &&op_Vcall_V_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_I)] = &&op_Vcall_V_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Vcall_V_V)] = &&op_Vcall_V_V;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_R)] = &&op_RVcall_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_A)] = &&op_RVcall_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_I)] = &&op_RVcall_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_R_V)] = &&op_RVcall_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_R)] = &&op_RVcall_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_A)] = &&op_RVcall_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_I)] = &&op_RVcall_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_A_V)] = &&op_RVcall_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_R)] = &&op_RVcall_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_A)] = &&op_RVcall_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_I)] = &&op_RVcall_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_I_V)] = &&op_RVcall_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_R)] = &&op_RVcall_V_R;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_A)] = &&op_RVcall_V_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_I)] = &&op_RVcall_V_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RVcall_V_V)] = &&op_RVcall_V_V;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_R)] = &&op_NtvCall_R;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_A)] = &&op_NtvCall_A;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_I)] = &&op_NtvCall_I;
+		handlers[static_cast<uint32_t>(Mnemonic::NtvCall_V)] = &&op_NtvCall_V;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_R_A)] = &&op_GetNtvId_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_R_I)] = &&op_GetNtvId_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_A_A)] = &&op_GetNtvId_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_A_I)] = &&op_GetNtvId_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_I_A)] = &&op_GetNtvId_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::GetNtvId_I_I)] = &&op_GetNtvId_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_R_R)] = &&op_Xchg_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_R_A)] = &&op_Xchg_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_R_I)] = &&op_Xchg_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_A_R)] = &&op_Xchg_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_A_A)] = &&op_Xchg_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_A_I)] = &&op_Xchg_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_I_R)] = &&op_Xchg_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_I_A)] = &&op_Xchg_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Xchg_I_I)] = &&op_Xchg_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::ClrCb)] = &&op_ClrCb;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_A_A)] = &&op_Hotpatch_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_A_I)] = &&op_Hotpatch_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_I_A)] = &&op_Hotpatch_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Hotpatch_I_I)] = &&op_Hotpatch_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_A_A)] = &&op_RHotpatch_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_A_I)] = &&op_RHotpatch_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_I_A)] = &&op_RHotpatch_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::RHotpatch_I_I)] = &&op_RHotpatch_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_R)] = &&op_EnableExt_R;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_A)] = &&op_EnableExt_A;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_I)] = &&op_EnableExt_I;
+		handlers[static_cast<uint32_t>(Mnemonic::EnableExt_V)] = &&op_EnableExt_V;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_R)] = &&op_DisableExt_R;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_A)] = &&op_DisableExt_A;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_I)] = &&op_DisableExt_I;
+		handlers[static_cast<uint32_t>(Mnemonic::DisableExt_V)] = &&op_DisableExt_V;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_R)] = &&op_IsExtEnabled_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_A)] = &&op_IsExtEnabled_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_I)] = &&op_IsExtEnabled_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_R_V)] = &&op_IsExtEnabled_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_R)] = &&op_IsExtEnabled_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_A)] = &&op_IsExtEnabled_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_I)] = &&op_IsExtEnabled_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_A_V)] = &&op_IsExtEnabled_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_R)] = &&op_IsExtEnabled_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_A)] = &&op_IsExtEnabled_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_I)] = &&op_IsExtEnabled_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::IsExtEnabled_I_V)] = &&op_IsExtEnabled_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_R)] = &&op_SetSegmntAccs_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_A)] = &&op_SetSegmntAccs_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_I)] = &&op_SetSegmntAccs_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_R_V)] = &&op_SetSegmntAccs_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_R)] = &&op_SetSegmntAccs_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_A)] = &&op_SetSegmntAccs_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_I)] = &&op_SetSegmntAccs_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_A_V)] = &&op_SetSegmntAccs_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_R)] = &&op_SetSegmntAccs_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_A)] = &&op_SetSegmntAccs_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_I)] = &&op_SetSegmntAccs_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_I_V)] = &&op_SetSegmntAccs_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_R)] = &&op_SetSegmntAccs_V_R;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_A)] = &&op_SetSegmntAccs_V_A;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_I)] = &&op_SetSegmntAccs_V_I;
+		handlers[static_cast<uint32_t>(Mnemonic::SetSegmntAccs_V_V)] = &&op_SetSegmntAccs_V_V;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_R)] = &&op_GetSegmntAccs_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_A)] = &&op_GetSegmntAccs_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_I)] = &&op_GetSegmntAccs_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_R_V)] = &&op_GetSegmntAccs_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_R)] = &&op_GetSegmntAccs_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_A)] = &&op_GetSegmntAccs_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_I)] = &&op_GetSegmntAccs_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_A_V)] = &&op_GetSegmntAccs_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_R)] = &&op_GetSegmntAccs_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_A)] = &&op_GetSegmntAccs_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_I)] = &&op_GetSegmntAccs_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::GetSegmntAccs_I_V)] = &&op_GetSegmntAccs_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_R)] = &&op_Add_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_I)] = &&op_Add_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_A)] = &&op_Add_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_R_V)] = &&op_Add_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_R)] = &&op_Add_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_I)] = &&op_Add_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_A)] = &&op_Add_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_I_V)] = &&op_Add_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_R)] = &&op_Add_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_I)] = &&op_Add_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_A)] = &&op_Add_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Add_A_V)] = &&op_Add_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_R)] = &&op_Sub_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_A)] = &&op_Sub_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_I)] = &&op_Sub_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_R_V)] = &&op_Sub_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_R)] = &&op_Sub_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_A)] = &&op_Sub_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_I)] = &&op_Sub_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_A_V)] = &&op_Sub_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_R)] = &&op_Sub_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_A)] = &&op_Sub_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_I)] = &&op_Sub_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Sub_I_V)] = &&op_Sub_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_R)] = &&op_Mul_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_A)] = &&op_Mul_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_I)] = &&op_Mul_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_R_V)] = &&op_Mul_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_R)] = &&op_Mul_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_A)] = &&op_Mul_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_I)] = &&op_Mul_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_A_V)] = &&op_Mul_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_R)] = &&op_Mul_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_A)] = &&op_Mul_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_I)] = &&op_Mul_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mul_I_V)] = &&op_Mul_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_R)] = &&op_Div_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_A)] = &&op_Div_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_I)] = &&op_Div_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_R_V)] = &&op_Div_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_R)] = &&op_Div_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_A)] = &&op_Div_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_I)] = &&op_Div_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_A_V)] = &&op_Div_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_R)] = &&op_Div_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_A)] = &&op_Div_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_I)] = &&op_Div_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Div_I_V)] = &&op_Div_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_R)] = &&op_Mod_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_A)] = &&op_Mod_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_I)] = &&op_Mod_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_R_V)] = &&op_Mod_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_R)] = &&op_Mod_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_A)] = &&op_Mod_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_I)] = &&op_Mod_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_A_V)] = &&op_Mod_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_R)] = &&op_Mod_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_A)] = &&op_Mod_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_I)] = &&op_Mod_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Mod_I_V)] = &&op_Mod_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_R)] = &&op_Lsh_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_A)] = &&op_Lsh_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_I)] = &&op_Lsh_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_R_V)] = &&op_Lsh_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_R)] = &&op_Lsh_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_A)] = &&op_Lsh_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_I)] = &&op_Lsh_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_A_V)] = &&op_Lsh_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_R)] = &&op_Lsh_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_A)] = &&op_Lsh_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_I)] = &&op_Lsh_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Lsh_I_V)] = &&op_Lsh_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_R)] = &&op_Rlsh_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_A)] = &&op_Rlsh_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_I)] = &&op_Rlsh_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_R_V)] = &&op_Rlsh_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_R)] = &&op_Rlsh_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_A)] = &&op_Rlsh_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_I)] = &&op_Rlsh_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_A_V)] = &&op_Rlsh_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_R)] = &&op_Rlsh_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_A)] = &&op_Rlsh_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_I)] = &&op_Rlsh_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rlsh_I_V)] = &&op_Rlsh_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_R)] = &&op_Rsh_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_A)] = &&op_Rsh_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_I)] = &&op_Rsh_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_R_V)] = &&op_Rsh_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_R)] = &&op_Rsh_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_A)] = &&op_Rsh_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_I)] = &&op_Rsh_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_A_V)] = &&op_Rsh_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_R)] = &&op_Rsh_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_A)] = &&op_Rsh_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_I)] = &&op_Rsh_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rsh_I_V)] = &&op_Rsh_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_R)] = &&op_Rrsh_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_A)] = &&op_Rrsh_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_I)] = &&op_Rrsh_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_R_V)] = &&op_Rrsh_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_R)] = &&op_Rrsh_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_A)] = &&op_Rrsh_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_I)] = &&op_Rrsh_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_A_V)] = &&op_Rrsh_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_R)] = &&op_Rrsh_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_A)] = &&op_Rrsh_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_I)] = &&op_Rrsh_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Rrsh_I_V)] = &&op_Rrsh_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_R)] = &&op_And_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_A)] = &&op_And_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_I)] = &&op_And_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::And_R_V)] = &&op_And_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_R)] = &&op_And_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_A)] = &&op_And_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_I)] = &&op_And_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::And_A_V)] = &&op_And_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_R)] = &&op_And_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_A)] = &&op_And_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_I)] = &&op_And_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::And_I_V)] = &&op_And_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_R)] = &&op_Or_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_A)] = &&op_Or_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_I)] = &&op_Or_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_R_V)] = &&op_Or_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_R)] = &&op_Or_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_A)] = &&op_Or_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_I)] = &&op_Or_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_A_V)] = &&op_Or_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_R)] = &&op_Or_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_A)] = &&op_Or_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_I)] = &&op_Or_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Or_I_V)] = &&op_Or_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_R)] = &&op_Xor_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_A)] = &&op_Xor_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_I)] = &&op_Xor_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_R_V)] = &&op_Xor_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_R)] = &&op_Xor_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_A)] = &&op_Xor_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_I)] = &&op_Xor_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_A_V)] = &&op_Xor_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_R)] = &&op_Xor_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_A)] = &&op_Xor_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_I)] = &&op_Xor_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Xor_I_V)] = &&op_Xor_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_R)] = &&op_Eq_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_A)] = &&op_Eq_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_I)] = &&op_Eq_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_R_V)] = &&op_Eq_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_R)] = &&op_Eq_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_A)] = &&op_Eq_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_I)] = &&op_Eq_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_A_V)] = &&op_Eq_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_R)] = &&op_Eq_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_A)] = &&op_Eq_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_I)] = &&op_Eq_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Eq_I_V)] = &&op_Eq_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_R)] = &&op_Neq_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_A)] = &&op_Neq_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_I)] = &&op_Neq_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_R_V)] = &&op_Neq_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_R)] = &&op_Neq_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_A)] = &&op_Neq_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_I)] = &&op_Neq_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_A_V)] = &&op_Neq_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_R)] = &&op_Neq_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_A)] = &&op_Neq_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_I)] = &&op_Neq_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Neq_I_V)] = &&op_Neq_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_R)] = &&op_Lt_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_A)] = &&op_Lt_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_I)] = &&op_Lt_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_R_V)] = &&op_Lt_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_R)] = &&op_Lt_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_A)] = &&op_Lt_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_I)] = &&op_Lt_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_A_V)] = &&op_Lt_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_R)] = &&op_Lt_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_A)] = &&op_Lt_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_I)] = &&op_Lt_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Lt_I_V)] = &&op_Lt_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_R)] = &&op_Bt_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_A)] = &&op_Bt_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_I)] = &&op_Bt_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_R_V)] = &&op_Bt_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_R)] = &&op_Bt_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_A)] = &&op_Bt_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_I)] = &&op_Bt_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_A_V)] = &&op_Bt_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_R)] = &&op_Bt_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_A)] = &&op_Bt_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_I)] = &&op_Bt_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Bt_I_V)] = &&op_Bt_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Not_R)] = &&op_Not_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Not_A)] = &&op_Not_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Not_I)] = &&op_Not_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_R)] = &&op_Test_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_A)] = &&op_Test_R_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_I)] = &&op_Test_R_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_R_V)] = &&op_Test_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_R)] = &&op_Test_A_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_A)] = &&op_Test_A_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_I)] = &&op_Test_A_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_A_V)] = &&op_Test_A_V;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_R)] = &&op_Test_I_R;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_A)] = &&op_Test_I_A;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_I)] = &&op_Test_I_I;
+		handlers[static_cast<uint32_t>(Mnemonic::Test_I_V)] = &&op_Test_I_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMov_R_R)] = &&op_FpMov_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMov_R_V)] = &&op_FpMov_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpAdd_R_R)] = &&op_FpAdd_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpAdd_R_V)] = &&op_FpAdd_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSub_R_R)] = &&op_FpSub_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSub_R_V)] = &&op_FpSub_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMul_R_R)] = &&op_FpMul_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMul_R_V)] = &&op_FpMul_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpDiv_R_R)] = &&op_FpDiv_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpDiv_R_V)] = &&op_FpDiv_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSign_R)] = &&op_FpSign_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSign_V)] = &&op_FpSign_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRound_R)] = &&op_FpRound_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpFloor_R)] = &&op_FpFloor_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCeil_R)] = &&op_FpCeil_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_R_R)] = &&op_FpTest_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_R_V)] = &&op_FpTest_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_V_R)] = &&op_FpTest_V_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTest_V_V)] = &&op_FpTest_V_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMod_R_R)] = &&op_FpMod_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpMod_R_V)] = &&op_FpMod_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpNan_R)] = &&op_FpNan_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpInf_R)] = &&op_FpInf_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPi_R)] = &&op_FpPi_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpE_R)] = &&op_FpE_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCstLn2_R)] = &&op_FpCstLn2_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCstLn10_R)] = &&op_FpCstLn10_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCstLog10_R)] = &&op_FpCstLog10_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSin_R_R)] = &&op_FpSin_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSin_R_V)] = &&op_FpSin_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCos_R_R)] = &&op_FpCos_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCos_R_V)] = &&op_FpCos_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTan_R_R)] = &&op_FpTan_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpTan_R_V)] = &&op_FpTan_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLn_R_R)] = &&op_FpLn_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLn_R_V)] = &&op_FpLn_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog2_R_R)] = &&op_FpLog2_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog2_R_V)] = &&op_FpLog2_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog10_R_R)] = &&op_FpLog10_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpLog10_R_V)] = &&op_FpLog10_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRoot_R)] = &&op_FpRoot_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpCsqrt_R)] = &&op_FpCsqrt_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpSq_R)] = &&op_FpSq_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPow_R_R)] = &&op_FpPow_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRoot_R_R)] = &&op_FpRoot_R_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPow_R_V)] = &&op_FpPow_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpRoot_R_V)] = &&op_FpRoot_R_V;
+		handlers[static_cast<uint32_t>(Mnemonic::FpExp_R)] = &&op_FpExp_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPrint_R)] = &&op_FpPrint_R;
+		handlers[static_cast<uint32_t>(Mnemonic::FpPrint_V)] = &&op_FpPrint_V;
+		handlers[static_cast<uint32_t>(Mnemonic::MvSignFlag_R)] = &&op_MvSignFlag_R;
+		handlers[static_cast<uint32_t>(Mnemonic::MvSignFlag_A)] = &&op_MvSignFlag_A;
+		handlers[static_cast<uint32_t>(Mnemonic::MvSignFlag_I)] = &&op_MvSignFlag_I;
+		handlers[static_cast<uint32_t>(Mnemonic::MvInfFlag_R)] = &&op_MvInfFlag_R;
+		handlers[static_cast<uint32_t>(Mnemonic::MvInfFlag_A)] = &&op_MvInfFlag_A;
+		handlers[static_cast<uint32_t>(Mnemonic::MvInfFlag_I)] = &&op_MvInfFlag_I;
+		handlers[static_cast<uint32_t>(Mnemonic::MvNanFlag_R)] = &&op_MvNanFlag_R;
+		handlers[static_cast<uint32_t>(Mnemonic::MvNanFlag_A)] = &&op_MvNanFlag_A;
+		handlers[static_cast<uint32_t>(Mnemonic::MvNanFlag_I)] = &&op_MvNanFlag_I;
+
+		DecodedInstruction* decoded;
+		Instruction* instr;
+		//Instructions outside of decoded segments are decoded in here
+		DecodedInstruction undecoded;
+
+		//Position in the running basic block, ahead of the members while remaining is not 0
+		DecodedInstruction* cursor = blockNext;
+		uint32_t remaining = precharged;
+		uint32_t ip = instrPtr;
+
+#define SBL_STORE()																		do {																				instrPtr = ip;																	lastExecuted = &decoded->instr;													blockNext = cursor;																precharged = remaining;														} while (false)
+
+#define SBL_SYNC()																		do {																				if (remaining)																		SBL_STORE();															} while (false)
+
+#define SBL_LOAD()																		do {																				cursor = blockNext;																remaining = precharged;															ip = instrPtr;																} while (false)
+
+#ifdef SBL_JIT
+#define SBL_RUN_JIT()															\
+			if (_runJit<Profile>(decoded))										\
+				goto op_Jitted
+#else
+#define SBL_RUN_JIT()
+#endif
+
+#ifdef SBL_AOT
+#define SBL_RUN_AOT()															\
+			if (decoded->aot && aotModule) {									\
+				if (!_runAot(decoded))											\
+					return;														\
+				goto op_Aot;													\
+			}
+#else
+#define SBL_RUN_AOT()
+#endif
+
+		//Same as VM::_execute, but instead of returning to the caller
+		//jumps into the handler of the fetched instruction
+#define SBL_DISPATCH()															\
+		do {																	\
+			if (remaining) {													\
+				decoded = cursor;												\
+				cursor += 3;													\
+				ip += 3;														\
+				if (!--remaining)												\
+					SBL_STORE();												\
+			}																	\
+			else {																\
+				if (!_countInstruction<Profile>())								\
+					return;														\
+				decoded = _fetchDecoded(instrPtr);								\
+				if (!decoded) {													\
+					auto memPtr = _checkExecutable(instrPtr);					\
+					if (!memPtr)												\
+						return;													\
+					_decode(undecoded, memPtr);									\
+					decoded = &undecoded;										\
+					if (Profile::verified && !_isRunnable(undecoded)) {			\
+						instrPtr += 3;											\
+						lastExecuted = &undecoded.instr;						\
+						if (!_canPerformDecoded<typename Profile::Unverified>(decoded))	\
+							return;												\
+						instr = &undecoded.instr;								\
+						goto op_Fallback;										\
+					}															\
+				}																\
+				instrPtr += 3;													\
+				lastExecuted = &decoded->instr;									\
+				if (!_canPerformDecoded<Profile>(decoded))						\
+					return;														\
+				SBL_RUN_AOT();													\
+				SBL_RUN_JIT();													\
+				_startBlock<Profile>(decoded);									\
+				SBL_LOAD();														\
+			}																	\
+			instr = &decoded->instr;											\
+			if (decoded->fusion) {												\
+				SBL_SYNC();														\
+				if (_shouldFuse<Profile>(decoded))								\
+					goto op_Fused;												\
+			}																	\
+			if (!Profile::verified												\
+				&& !(decoded->flags & DecodedInstruction::Resolved))			\
+				goto op_Fallback;												\
+			goto *handlers[static_cast<uint32_t>(instr->mnemonic)];				\
+		} while (false)
+
+		SBL_DISPATCH();
+
+		/*
+			Basic instructions
+		*/
+	op_Nop:
+
+		SBL_DISPATCH();
+	op_Halt:
+	op_End:
+		SBL_SYNC();
+		return;
+		SBL_DISPATCH();
+	op_Ret:
+		SBL_SYNC();
+		instrPtr = _popStack();
+		--callDepth;
+		SBL_DISPATCH();
+	op_Loop:
+		SBL_SYNC();
+		_pushStack(loopPtr);
+		loopPtr = instrPtr;
+		SBL_DISPATCH();
+	op_Endloop:
+		SBL_SYNC();
+		if (!registers[10]) {
+			loopPtr = _popStack();
+		}
+		else if (--registers[10]) {
+			instrPtr = loopPtr;
+		}
+		else {
+			loopPtr = _popStack();
+		}
+		SBL_DISPATCH();
+	op_Push_R:
+		SBL_SYNC();
+		_pushStack(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Push_A:
+		SBL_SYNC();
+		_pushStack(_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Push_I:
+		SBL_SYNC();
+		_pushStack(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Push_V:
+		SBL_SYNC();
+		_pushStack(_tryRead(Value{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Push_All:
+		SBL_SYNC();
+		for (size_t i = 0, j = registers.size(); i < j; ++i) {
+			_pushStack(registers[i]);
+		}
+		SBL_DISPATCH();
+	op_Pop_R:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _popStack());
+		SBL_DISPATCH();
+	op_Pop_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _popStack());
+		SBL_DISPATCH();
+	op_Pop_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _popStack());
+		SBL_DISPATCH();
+	op_Pop_All:
+		SBL_SYNC();
+		for (size_t i = registers.size() - 1, j = 0; i >= j; --i) {
+			registers[i] = _popStack();
+		}
+		SBL_DISPATCH();
+	op_Clear_All:
+		SBL_SYNC();
+		for (size_t i = 0, j = registers.size() - 4; i < j; ++i) {
+			registers[i] = 0;
+		}
+		SBL_DISPATCH();
+	op_Inc_R:
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, 1);
+		SBL_DISPATCH();
+	op_Inc_A:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, 1);
+		SBL_DISPATCH();
+	op_Inc_I:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, 1);
+		SBL_DISPATCH();
+	op_Dec_R:
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, -1);
+		SBL_DISPATCH();
+	op_Dec_A:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, -1);
+		SBL_DISPATCH();
+	op_Dec_I:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, -1);
+		SBL_DISPATCH();
+	op_Call_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		++callDepth;
+		SBL_DISPATCH();
+	op_Call_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		++callDepth;
+		SBL_DISPATCH();
+	op_Call_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		++callDepth;
+		SBL_DISPATCH();
+	op_RCall_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		++callDepth;
+		SBL_DISPATCH();
+	op_RCall_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		++callDepth;
+		SBL_DISPATCH();
+	op_RCall_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		++callDepth;
+		SBL_DISPATCH();
+	op_Read_R:
+		std::cin >> _tryRead(ResolvedRegister{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_Read_A:
+		SBL_SYNC();
+		std::cin >> _tryRead(Address{ instr->arg1 });
+		SBL_DISPATCH();
+	op_Read_I:
+		SBL_SYNC();
+		std::cin >> _tryRead(ResolvedIndirect{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_Readstr_A:
+		SBL_SYNC();
+		std::cin >> reinterpret_cast<char*>(&_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Readstr_I:
+		SBL_SYNC();
+		std::cin >> reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Print_R:
+		std::cout << _tryRead(ResolvedRegister{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_Print_A:
+		SBL_SYNC();
+		std::cout << _tryRead(Address{ instr->arg1 });
+		SBL_DISPATCH();
+	op_Print_I:
+		SBL_SYNC();
+		std::cout << _tryRead(ResolvedIndirect{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_Print_V:
+		std::cout << _tryRead(Value{ instr->arg1 });
+		SBL_DISPATCH();
+	op_PrintS_R:
+		SBL_SYNC();
+		std::cout << static_cast<int32_t>(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_PrintS_A:
+		SBL_SYNC();
+		std::cout << static_cast<int32_t>(_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_PrintS_I:
+		SBL_SYNC();
+		std::cout << static_cast<int32_t>(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_PrintS_V:
+		SBL_SYNC();
+		std::cout << static_cast<int32_t>(_tryRead(Value{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_PrintC_R:
+		SBL_SYNC();
+		std::cout << static_cast<char>(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_PrintC_A:
+		SBL_SYNC();
+		std::cout << static_cast<char>(_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_PrintC_I:
+		SBL_SYNC();
+		std::cout << static_cast<char>(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_PrintC_V:
+		SBL_SYNC();
+		std::cout << static_cast<char>(_tryRead(Value{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Printstr_A:
+		SBL_SYNC();
+		std::cout << reinterpret_cast<char*>(&_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Printstr_I:
+		SBL_SYNC();
+		std::cout << reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Jmp_R:
+		SBL_SYNC();
+		instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_Jmp_A:
+		SBL_SYNC();
+		instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		SBL_DISPATCH();
+	op_Jmp_I:
+		SBL_SYNC();
+		instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_Jb_R:
+	op_Jnle_R:
+		SBL_SYNC();
+		if (controlByte & TestBigger) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jb_A:
+	op_Jnle_A:
+		SBL_SYNC();
+		if (controlByte & TestBigger) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_Jb_I:
+	op_Jnle_I:
+		SBL_SYNC();
+		if (controlByte & TestBigger) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnb_R:
+	op_Jle_R:
+		SBL_SYNC();
+		if (controlByte & TestSmallerEqual) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnb_A:
+	op_Jle_A:
+		SBL_SYNC();
+		if (controlByte & TestSmallerEqual) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnb_I:
+	op_Jle_I:
+		SBL_SYNC();
+		if (controlByte & TestSmallerEqual) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jbe_R:
+	op_Jnl_R:
+		SBL_SYNC();
+		if (controlByte & TestBiggerEqual) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jbe_A:
+	op_Jnl_A:
+		SBL_SYNC();
+		if (controlByte & TestBiggerEqual) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_Jbe_I:
+	op_Jnl_I:
+		SBL_SYNC();
+		if (controlByte & TestBiggerEqual) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnbe_R:
+	op_Jl_R:
+		SBL_SYNC();
+		if (controlByte & TestSmaller) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnbe_A:
+	op_Jl_A:
+		SBL_SYNC();
+		if (controlByte & TestSmaller) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnbe_I:
+	op_Jl_I:
+		SBL_SYNC();
+		if (controlByte & TestSmaller) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jz_R:
+	op_Je_R:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jz_A:
+	op_Je_A:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_Jz_I:
+	op_Je_I:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnz_R:
+	op_Jne_R:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			instrPtr = _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnz_A:
+	op_Jne_A:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			instrPtr = _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_Jnz_I:
+	op_Jne_I:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			instrPtr = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJmp_R:
+		SBL_SYNC();
+		instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_RJmp_A:
+		SBL_SYNC();
+		instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		SBL_DISPATCH();
+	op_RJmp_I:
+		SBL_SYNC();
+		instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		SBL_DISPATCH();
+	op_RJb_R:
+	op_RJnle_R:
+		SBL_SYNC();
+		if (controlByte & TestBigger) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJb_A:
+	op_RJnle_A:
+		SBL_SYNC();
+		if (controlByte & TestBigger) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_RJb_I:
+	op_RJnle_I:
+		SBL_SYNC();
+		if (controlByte & TestBigger) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnb_R:
+	op_RJle_R:
+		SBL_SYNC();
+		if (controlByte & TestSmallerEqual) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnb_A:
+	op_RJle_A:
+		SBL_SYNC();
+		if (controlByte & TestSmallerEqual) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnb_I:
+	op_RJle_I:
+		SBL_SYNC();
+		if (controlByte & TestSmallerEqual) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJbe_R:
+	op_RJnl_R:
+		SBL_SYNC();
+		if (controlByte & TestBiggerEqual) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJbe_A:
+	op_RJnl_A:
+		SBL_SYNC();
+		if (controlByte & TestBiggerEqual) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_RJbe_I:
+	op_RJnl_I:
+		SBL_SYNC();
+		if (controlByte & TestBiggerEqual) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnbe_R:
+	op_RJl_R:
+		SBL_SYNC();
+		if (controlByte & TestSmaller) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnbe_A:
+	op_RJl_A:
+		SBL_SYNC();
+		if (controlByte & TestSmaller) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnbe_I:
+	op_RJl_I:
+		SBL_SYNC();
+		if (controlByte & TestSmaller) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJz_R:
+	op_RJe_R:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJz_A:
+	op_RJe_A:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_RJz_I:
+	op_RJe_I:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnz_R:
+	op_RJne_R:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			instrPtr += _tryReadDeref(ResolvedRegister{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnz_A:
+	op_RJne_A:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			instrPtr += _tryReadDeref(Address{ instr->arg1 });
+		}
+		SBL_DISPATCH();
+	op_RJnz_I:
+	op_RJne_I:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			instrPtr += _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		}
+		SBL_DISPATCH();
+	op_Time_R:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, static_cast<uint32_t>(getTime(startExecTime)));
+		SBL_DISPATCH();
+	op_Time_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, static_cast<uint32_t>(getTime(startExecTime)));
+		SBL_DISPATCH();
+	op_Time_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, static_cast<uint32_t>(getTime(startExecTime)));
+		SBL_DISPATCH();
+	op_Time64_R:
+		SBL_SYNC();
+	{
+		auto& v1 = _tryRead(ResolvedRegister{ decoded->regArg1 });
+		auto& v2 = _tryRead(Register{ instr->arg1 + 1 });
+		_writeTime(getTime(startExecTime), v1, v2);
+	}
+	SBL_DISPATCH();
+	op_Time64_A:
+		SBL_SYNC();
+	{
+		auto& v1 = _tryRead(Address{ instr->arg1 });
+		auto& v2 = _tryRead(Address{ instr->arg1 + 1 });
+		_writeTime(getTime(startExecTime), v1, v2);
+	}
+	SBL_DISPATCH();
+	op_Time64_I:
+		SBL_SYNC();
+	{
+		auto& v1 = _tryRead(ResolvedIndirect{ decoded->regArg1 });
+		auto& v2 = _tryRead(Indirect{ instr->arg1 + 1 });
+		_writeTime(getTime(startExecTime), v1, v2);
+	}
+	SBL_DISPATCH();
+	op_ICount_R:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, static_cast<uint32_t>(instrCount));
+		SBL_DISPATCH();
+	op_ICount_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, static_cast<uint32_t>(instrCount));
+		SBL_DISPATCH();
+	op_ICount_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, static_cast<uint32_t>(instrCount));
+		SBL_DISPATCH();
+	op_ICount64_R:
+		SBL_SYNC();
+	{
+		auto& v1 = _tryRead(ResolvedRegister{ decoded->regArg1 });
+		auto& v2 = _tryRead(Register{ instr->arg1 + 1 });
+		_writeTime(instrCount, v1, v2);
+	}
+	SBL_DISPATCH();
+	op_ICount64_A:
+		SBL_SYNC();
+	{
+		auto& v1 = _tryRead(Address{ instr->arg1 });
+		auto& v2 = _tryRead(Address{ instr->arg1 + 1 });
+		_writeTime(instrCount, v1, v2);
+	}
+	SBL_DISPATCH();
+	op_ICount64_I:
+		SBL_SYNC();
+	{
+		auto& v1 = _tryRead(ResolvedIndirect{ decoded->regArg1 });
+		auto& v2 = _tryRead(Indirect{ instr->arg1 + 1 });
+		_writeTime(instrCount, v1, v2);
+	}
+	SBL_DISPATCH();
+	op_ExecInstr_A:
+		SBL_SYNC();
+	{
+		auto derefed = _tryReadDeref(Address{ instr->arg1 });
+		if (!_checkExecutable(derefed))
+			return;
+		auto memPtr = memory.memory.tryAccess(derefed, SegmentAccessType::Executable);
+		if (!memPtr) {
+			error = { ErrorCode::UnallowedSegmentExec, instrPtr };
+			running = false;
+			return;
+		}
+		if (!_perform(Instruction::fromAddress(memPtr)))
+			return;
+	}
+	SBL_DISPATCH();
+	op_ExecInstr_I:
+		SBL_SYNC();
+	{
+		auto derefed = _tryReadDeref(ResolvedIndirect{ decoded->regArg1 });
+		if (!_checkExecutable(derefed))
+			return;
+		auto memPtr = memory.memory.tryAccess(derefed, SegmentAccessType::Executable);
+		if (!memPtr) {
+			error = { ErrorCode::UnallowedSegmentExec, instrPtr };
+			running = false;
+			return;
+		}
+		if (!_perform(Instruction::fromAddress(memPtr)))
+			return;
+	}
+	SBL_DISPATCH();
+	op_Mov_R_R:
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mov_R_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mov_R_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mov_R_V:
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mov_A_R:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mov_A_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mov_A_I:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mov_A_V:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mov_I_R:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mov_I_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mov_I_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mov_I_V:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Move_R_R:
+	op_Movz_R_R:
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_R_A:
+	op_Movz_R_A:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_R_I:
+	op_Movz_R_I:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_R_V:
+	op_Movz_R_V:
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_A_R:
+	op_Movz_A_R:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_A_A:
+	op_Movz_A_A:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_A_I:
+	op_Movz_A_I:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_A_V:
+	op_Movz_A_V:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_I_R:
+	op_Movz_I_R:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_I_A:
+	op_Movz_I_A:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_I_I:
+	op_Movz_I_I:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Move_I_V:
+	op_Movz_I_V:
+		SBL_SYNC();
+		if (controlByte & TestEqual) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_R_R:
+	op_Movnz_R_R:
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_R_A:
+	op_Movnz_R_A:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_R_I:
+	op_Movnz_R_I:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_R_V:
+	op_Movnz_R_V:
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_A_R:
+	op_Movnz_A_R:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_A_A:
+	op_Movnz_A_A:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_A_I:
+	op_Movnz_A_I:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_A_V:
+	op_Movnz_A_V:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_I_R:
+	op_Movnz_I_R:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_I_A:
+	op_Movnz_I_A:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_I_I:
+	op_Movnz_I_I:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		}
+		SBL_DISPATCH();
+	op_Movne_I_V:
+	op_Movnz_I_V:
+		SBL_SYNC();
+		if (controlByte & TestUnequal) {
+			_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		}
+		SBL_DISPATCH();
+	op_Laddr_R_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryReadAddr(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Laddr_R_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryReadAddr(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Laddr_A_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryReadAddr(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Laddr_A_I:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryReadAddr(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Laddr_I_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryReadAddr(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Laddr_I_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryReadAddr(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Loadload_R_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ _tryRead(Address{ instr->arg2 }) }));
+		SBL_DISPATCH();
+	op_Loadload_R_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg2 }) }));
+		SBL_DISPATCH();
+	op_Loadload_A_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ _tryRead(Address{ instr->arg2 }) }));
+		SBL_DISPATCH();
+	op_Loadload_A_I:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg2 }) }));
+		SBL_DISPATCH();
+	op_Loadload_I_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ _tryRead(Address{ instr->arg2 }) }));
+		SBL_DISPATCH();
+	op_Loadload_I_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg2 }) }));
+		SBL_DISPATCH();
+	op_Vcall_R_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_R_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_R_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_R_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_A_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_A_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_A_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_A_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_I_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_I_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_I_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_I_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_V_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_V_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_V_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_Vcall_V_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr = _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_R_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_R_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_R_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_R_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedRegister{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_A_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_A_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_A_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_A_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Address{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_I_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_I_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_I_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_I_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(ResolvedIndirect{ decoded->regArg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_V_R:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedRegister{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_V_A:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Address{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_V_I:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(ResolvedIndirect{ decoded->regArg2 }) });
+		SBL_DISPATCH();
+	op_RVcall_V_V:
+		SBL_SYNC();
+		_pushStack(instrPtr);
+		instrPtr += _tryRead(Address{ _tryRead(Value{ instr->arg1 }) + _tryRead(Value{ instr->arg2 }) });
+		SBL_DISPATCH();
+	op_NtvCall_R:
+		SBL_SYNC();
+		_doNativeCall(_tryRead(ResolvedRegister{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_NtvCall_A:
+		SBL_SYNC();
+		_doNativeCall(_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_NtvCall_I:
+		SBL_SYNC();
+		_doNativeCall(_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_NtvCall_V:
+		SBL_SYNC();
+		_doNativeCall(_tryRead(Value{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_GetNtvId_R_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(Address{ instr->arg2 }))));
+		SBL_DISPATCH();
+	op_GetNtvId_R_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg2 }))));
+		SBL_DISPATCH();
+	op_GetNtvId_A_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(Address{ instr->arg2 }))));
+		SBL_DISPATCH();
+	op_GetNtvId_A_I:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg2 }))));
+		SBL_DISPATCH();
+	op_GetNtvId_I_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(Address{ instr->arg2 }))));
+		SBL_DISPATCH();
+	op_GetNtvId_I_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, _findNativeByName(reinterpret_cast<char*>(&_tryRead(ResolvedIndirect{ decoded->regArg2 }))));
+		SBL_DISPATCH();
+	op_Xchg_R_R:
+		SBL_SYNC();
+		std::swap(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xchg_R_A:
+		SBL_SYNC();
+		std::swap(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xchg_R_I:
+		SBL_SYNC();
+		std::swap(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xchg_A_R:
+		SBL_SYNC();
+		std::swap(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xchg_A_A:
+		SBL_SYNC();
+		std::swap(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xchg_A_I:
+		SBL_SYNC();
+		std::swap(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xchg_I_R:
+		SBL_SYNC();
+		std::swap(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xchg_I_A:
+		SBL_SYNC();
+		std::swap(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xchg_I_I:
+		SBL_SYNC();
+		std::swap(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_ClrCb:
+		controlByte = 0;
+		SBL_DISPATCH();
+	op_Hotpatch_A_A:
+		SBL_SYNC();
+		_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Hotpatch_A_I:
+		SBL_SYNC();
+		_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Hotpatch_I_A:
+		SBL_SYNC();
+		_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Hotpatch_I_I:
+		SBL_SYNC();
+		_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_RHotpatch_A_A:
+		SBL_SYNC();
+		_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, Address{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_RHotpatch_A_I:
+		SBL_SYNC();
+		_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, Address{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_RHotpatch_I_A:
+		SBL_SYNC();
+		_writeN(&_tryRead(Address{ instr->arg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, ResolvedIndirect{ decoded->regArg1 })));
+		SBL_DISPATCH();
+	op_RHotpatch_I_I:
+		SBL_SYNC();
+		_writeN(&_tryRead(ResolvedIndirect{ decoded->regArg2 }), 3, &_tryRead(_tryAdd(Address{ instrPtr }, ResolvedIndirect{ decoded->regArg1 })));
+		SBL_DISPATCH();
+	op_EnableExt_R:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg1 }))].enabled = true;
+		SBL_DISPATCH();
+	op_EnableExt_A:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg1 }))].enabled = true;
+		SBL_DISPATCH();
+	op_EnableExt_I:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg1 }))].enabled = true;
+		SBL_DISPATCH();
+	op_EnableExt_V:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg1 }))].enabled = true;
+		SBL_DISPATCH();
+	op_DisableExt_R:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg1 }))].enabled = false;
+		SBL_DISPATCH();
+	op_DisableExt_A:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg1 }))].enabled = false;
+		SBL_DISPATCH();
+	op_DisableExt_I:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg1 }))].enabled = false;
+		SBL_DISPATCH();
+	op_DisableExt_V:
+		SBL_SYNC();
+		extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg1 }))].enabled = false;
+		SBL_DISPATCH();
+	op_IsExtEnabled_R_R:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_R_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_R_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_R_V:
+		SBL_SYNC();
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_A_R:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_A_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_A_I:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_A_V:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_I_R:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedRegister{ decoded->regArg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_I_A:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Address{ instr->arg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_I_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(ResolvedIndirect{ decoded->regArg2 }))].enabled);
+		SBL_DISPATCH();
+	op_IsExtEnabled_I_V:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, extensionData[static_cast<uint8_t>(_tryRead(Value{ instr->arg2 }))].enabled);
+		SBL_DISPATCH();
+	op_SetSegmntAccs_R_R:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_R_A:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_R_I:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_R_V:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_A_R:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_A_A:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_A_I:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_A_V:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_I_R:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_I_A:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_I_I:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_I_V:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_V_R:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_V_A:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_V_I:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_SetSegmntAccs_V_V:
+		SBL_SYNC();
+		_setSegmentAccess(_tryRead(Value{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_R_R:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_R_A:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_R_I:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_R_V:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_A_R:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_A_A:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_A_I:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_A_V:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_I_R:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_I_A:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_I_I:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_GetSegmntAccs_I_V:
+		SBL_SYNC();
+		_getSegmentAccess(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+
+		/*
+			Arithmetic instructions
+		*/
+	op_Add_R_R:
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Add_R_I:
+		SBL_SYNC();
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Add_R_A:
+		SBL_SYNC();
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Add_R_V:
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Add_I_R:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Add_I_I:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Add_I_A:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Add_I_V:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Add_A_R:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Add_A_I:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Add_A_A:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Add_A_V:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Sub_R_R:
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(ResolvedRegister{ decoded->regArg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_R_A:
+		SBL_SYNC();
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(Address{ instr->arg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_R_I:
+		SBL_SYNC();
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(ResolvedIndirect{ decoded->regArg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_R_V:
+		_tryAdd(ResolvedRegister{ decoded->regArg1 }, ~_tryRead(Value{ instr->arg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_A_R:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, ~_tryRead(ResolvedRegister{ decoded->regArg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_A_A:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, ~_tryRead(Address{ instr->arg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_A_I:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, ~_tryRead(ResolvedIndirect{ decoded->regArg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_A_V:
+		SBL_SYNC();
+		_tryAdd(Address{ instr->arg1 }, ~_tryRead(Value{ instr->arg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_I_R:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(ResolvedRegister{ decoded->regArg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_I_A:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(Address{ instr->arg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_I_I:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(ResolvedIndirect{ decoded->regArg2 }) + 1);
+		SBL_DISPATCH();
+	op_Sub_I_V:
+		SBL_SYNC();
+		_tryAdd(ResolvedIndirect{ decoded->regArg1 }, ~_tryRead(Value{ instr->arg2 }) + 1);
+		SBL_DISPATCH();
+	op_Mul_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mul_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mul_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mul_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) * _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mul_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mul_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mul_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mul_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) * _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mul_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mul_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mul_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mul_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) * _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Div_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Div_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Div_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Div_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) / _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Div_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Div_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Div_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Div_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) / _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Div_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Div_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Div_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Div_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) / _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mod_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mod_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mod_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mod_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) % _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mod_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mod_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mod_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mod_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) % _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mod_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mod_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Mod_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Mod_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) % _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Lsh_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Lsh_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Lsh_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Lsh_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) << _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Lsh_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Lsh_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Lsh_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Lsh_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) << _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Lsh_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Lsh_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Lsh_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Lsh_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) << _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rlsh_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotl(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotl(_forceRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rlsh_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotl(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rsh_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Rsh_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rsh_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Rsh_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) >> _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rsh_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Rsh_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rsh_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Rsh_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) >> _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rsh_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Rsh_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rsh_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Rsh_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) >> _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Rrsh_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _rotr(_forceRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _rotr(_forceRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 })));
+		SBL_DISPATCH();
+	op_Rrsh_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _rotr(_forceRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 })));
+		SBL_DISPATCH();
+
+		/*
+			Logical instructions
+		*/
+	op_And_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_And_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_And_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_And_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) & _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_And_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_And_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_And_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_And_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) & _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_And_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_And_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_And_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_And_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) & _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Or_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Or_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Or_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Or_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) | _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Or_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Or_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Or_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Or_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) | _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Or_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Or_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Or_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Or_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) | _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xor_R_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xor_R_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xor_R_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xor_R_V:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, _forceRead(ResolvedRegister{ decoded->regArg1 }) ^ _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xor_A_R:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xor_A_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xor_A_I:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xor_A_V:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, _forceRead(Address{ instr->arg1 }) ^ _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xor_I_R:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xor_I_A:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Xor_I_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Xor_I_V:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, _forceRead(ResolvedIndirect{ decoded->regArg1 }) ^ _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Eq_R_R:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(ResolvedRegister{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_R_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(Address{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_R_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_R_V:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) == _tryRead(Value{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_A_R:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(ResolvedRegister{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_A_A:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(Address{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_A_I:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_A_V:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) == _tryRead(Value{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_I_R:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(ResolvedRegister{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_I_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(Address{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_I_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Eq_I_V:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) == _tryRead(Value{ instr->arg2 }), TestEqual | TestBiggerEqual | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Neq_R_R:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(ResolvedRegister{ decoded->regArg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_R_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(Address{ instr->arg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_R_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_R_V:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) != _tryRead(Value{ instr->arg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_A_R:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(ResolvedRegister{ decoded->regArg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_A_A:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(Address{ instr->arg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_A_I:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_A_V:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) != _tryRead(Value{ instr->arg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_I_R:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(ResolvedRegister{ decoded->regArg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_I_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(Address{ instr->arg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_I_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Neq_I_V:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) != _tryRead(Value{ instr->arg2 }), TestUnequal);
+		SBL_DISPATCH();
+	op_Lt_R_R:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(ResolvedRegister{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_R_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(Address{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_R_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_R_V:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) < _tryRead(Value{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_A_R:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(ResolvedRegister{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_A_A:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(Address{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_A_I:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_A_V:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) < _tryRead(Value{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_I_R:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(ResolvedRegister{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_I_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(Address{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_I_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Lt_I_V:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) < _tryRead(Value{ instr->arg2 }), TestSmaller | TestUnequal | TestSmallerEqual);
+		SBL_DISPATCH();
+	op_Bt_R_R:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(ResolvedRegister{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_R_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(Address{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_R_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_R_V:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }) > _tryRead(Value{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_A_R:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(ResolvedRegister{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_A_A:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(Address{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_A_I:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_A_V:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }) > _tryRead(Value{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_I_R:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(ResolvedRegister{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_I_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(Address{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_I_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(ResolvedIndirect{ decoded->regArg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Bt_I_V:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }) > _tryRead(Value{ instr->arg2 }), TestBigger | TestUnequal | TestBiggerEqual);
+		SBL_DISPATCH();
+	op_Not_R:
+		_assertReadWrite(ResolvedRegister{ decoded->regArg1 });
+		_forceWrite(ResolvedRegister{ decoded->regArg1 }, ~_forceRead(ResolvedRegister{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Not_A:
+		SBL_SYNC();
+		_assertReadWrite(Address{ instr->arg1 });
+		_forceWrite(Address{ instr->arg1 }, ~_forceRead(Address{ instr->arg1 }));
+		SBL_DISPATCH();
+	op_Not_I:
+		SBL_SYNC();
+		_assertReadWrite(ResolvedIndirect{ decoded->regArg1 });
+		_forceWrite(ResolvedIndirect{ decoded->regArg1 }, ~_forceRead(ResolvedIndirect{ decoded->regArg1 }));
+		SBL_DISPATCH();
+	op_Test_R_R:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Test_R_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Test_R_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Test_R_V:
+		setControl(_tryRead(ResolvedRegister{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Test_A_R:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Test_A_A:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Test_A_I:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Test_A_V:
+		SBL_SYNC();
+		setControl(_tryRead(Address{ instr->arg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Test_I_R:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedRegister{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Test_I_A:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Address{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_Test_I_I:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(ResolvedIndirect{ decoded->regArg2 }));
+		SBL_DISPATCH();
+	op_Test_I_V:
+		SBL_SYNC();
+		setControl(_tryRead(ResolvedIndirect{ decoded->regArg1 }), _tryRead(Value{ instr->arg2 }));
+		SBL_DISPATCH();
+
+		/*
+			Floating point instructions
+		*/
+	op_FpMov_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpMov_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpAdd_R_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) + _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpAdd_R_V:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) + _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpSub_R_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) - _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpSub_R_V:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) - _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpMul_R_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) * _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpMul_R_V:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) * _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpDiv_R_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) / _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpDiv_R_V:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, _forceRead(FpRegister{ instr->arg1 }) / _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpSign_R:
+		SBL_SYNC();
+	{
+		auto f = _tryRead(FpRegister{ instr->arg1 });
+		if (f < 0) {
+			controlByte |= TestFloatNegative;
+		}
+		else if (f > 0) {
+			controlByte |= TestFloatPositive;
+		}
+		else {
+			controlByte |= TestFloatZero;
+		}
+	}
+	SBL_DISPATCH();
+	op_FpSign_V:
+		SBL_SYNC();
+	{
+		auto f = _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) });
+		if (f < 0) {
+			controlByte |= TestFloatNegative;
+		}
+		else if (f > 0) {
+			controlByte |= TestFloatPositive;
+		}
+		else {
+			controlByte |= TestFloatZero;
+		}
+	}
+	SBL_DISPATCH();
+	op_FpRound_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, std::round(_forceRead(FpRegister{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_FpFloor_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, std::floor(_forceRead(FpRegister{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_FpCeil_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, std::ceil(_forceRead(FpRegister{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_FpTest_R_R:
+		SBL_SYNC();
+		setFloatControl(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpTest_R_V:
+		SBL_SYNC();
+		setFloatControl(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpTest_V_R:
+		SBL_SYNC();
+		setFloatControl(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) }), _tryRead(FpRegister{ instr->arg2 }));
+		SBL_DISPATCH();
+	op_FpTest_V_V:
+		SBL_SYNC();
+		setFloatControl(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) }));
+		SBL_DISPATCH();
+	op_FpMod_R_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_tryWrite(FpRegister{ instr->arg1 }, std::fmod(_forceRead(FpRegister{ instr->arg1 }), _tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpMod_R_V:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_tryWrite(FpRegister{ instr->arg1 }, std::fmod(_forceRead(FpRegister{ instr->arg1 }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpNan_R:
+		SBL_SYNC();
+		if (std::isnan(_tryRead(FpRegister{ instr->arg1 }))) {
+			controlByte |= TestFloatNan;
+		}
+		else {
+			controlByte &= ~TestFloatNan;
+		}
+		SBL_DISPATCH();
+	op_FpInf_R:
+		SBL_SYNC();
+		if (std::isinf(_tryRead(FpRegister{ instr->arg1 }))) {
+			controlByte |= TestFloatInf;
+		}
+		else {
+			controlByte &= ~TestFloatInf;
+		}
+		SBL_DISPATCH();
+	op_FpPi_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, 3.1415926536f);
+		SBL_DISPATCH();
+	op_FpE_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, 2.7182818285f);
+		SBL_DISPATCH();
+	op_FpCstLn2_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, 0.6931471806f);
+		SBL_DISPATCH();
+	op_FpCstLn10_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, 2.302585093f);
+		SBL_DISPATCH();
+	op_FpCstLog10_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, 0.3010299957f);
+		SBL_DISPATCH();
+	op_FpSin_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::sin(_tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpSin_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::sin(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpCos_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::cos(_tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpCos_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::cos(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpTan_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::tan(_tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpTan_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::tan(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpLn_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::log(_tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpLn_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::log(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpLog2_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::log2(_tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpLog2_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::log2(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpLog10_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::log10(_tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpLog10_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::log10(_tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpRoot_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::sqrt(_tryRead(FpRegister{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_FpCsqrt_R:
+		SBL_SYNC();
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, std::cbrt(_forceRead(FpRegister{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_FpSq_R:
+		SBL_SYNC();
+	{
+		_assertReadWrite(FpRegister{ instr->arg1 });
+		auto v = _forceRead(FpRegister{ instr->arg1 });
+		_forceWrite(FpRegister{ instr->arg1 }, v * v);
+	}
+	SBL_DISPATCH();
+	op_FpPow_R_R:
+	op_FpRoot_R_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::pow(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpRegister{ instr->arg2 })));
+		SBL_DISPATCH();
+	op_FpPow_R_V:
+	op_FpRoot_R_V:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::pow(_tryRead(FpRegister{ instr->arg1 }), _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg2) })));
+		SBL_DISPATCH();
+	op_FpExp_R:
+		SBL_SYNC();
+		_tryWrite(FpRegister{ instr->arg1 }, std::exp(_tryRead(FpRegister{ instr->arg1 })));
+		SBL_DISPATCH();
+	op_FpPrint_R:
+		SBL_SYNC();
+		std::cout << _tryRead(FpRegister{ instr->arg1 });
+		SBL_DISPATCH();
+	op_FpPrint_V:
+		SBL_SYNC();
+		std::cout << _tryRead(FpValue{ reinterpret_cast<float&>(instr->arg1) });
+		SBL_DISPATCH();
+	op_MvSignFlag_R:
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 6);
+		SBL_DISPATCH();
+	op_MvSignFlag_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 6);
+		SBL_DISPATCH();
+	op_MvSignFlag_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 6);
+		SBL_DISPATCH();
+	op_MvInfFlag_R:
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 9);
+		SBL_DISPATCH();
+	op_MvInfFlag_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 9);
+		SBL_DISPATCH();
+	op_MvInfFlag_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 9);
+		SBL_DISPATCH();
+	op_MvNanFlag_R:
+		_tryWrite(ResolvedRegister{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 10);
+		SBL_DISPATCH();
+	op_MvNanFlag_A:
+		SBL_SYNC();
+		_tryWrite(Address{ instr->arg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 10);
+		SBL_DISPATCH();
+	op_MvNanFlag_I:
+		SBL_SYNC();
+		_tryWrite(ResolvedIndirect{ decoded->regArg1 }, (controlByte & (TestFloatPositive | TestFloatNegative)) >> 10);
+		SBL_DISPATCH();
+
+	op_Fused:
+		if (!_performFused(decoded))
+			return;
+		SBL_LOAD();
+		SBL_DISPATCH();
+
+	op_Fallback:
+		SBL_SYNC();
+		if (!(this->*runners[static_cast<uint32_t>(instr->mnemonic) / 128])(instr))
+			return;
+		SBL_DISPATCH();
+
+#ifdef SBL_JIT
+	op_Jitted:
+		SBL_DISPATCH();
+#endif
+
+#ifdef SBL_AOT
+		//The region may have left the interpreter in the middle of a basic block
+	op_Aot:
+		SBL_LOAD();
+		SBL_DISPATCH();
+#endif
+
+#undef SBL_DISPATCH
+#undef SBL_LOAD
+#undef SBL_SYNC
+#undef SBL_STORE
+#undef SBL_RUN_JIT
+#undef SBL_RUN_AOT
+	}
+
+	template void VM::_loopThreaded<FullProfile>();
+	template void VM::_loopThreaded<NoPrivilegeProfile>();
+	template void VM::_loopThreaded<NoInterruptProfile>();
+	template void VM::_loopThreaded<MinimalProfile>();
+	template void VM::_loopThreaded<VerifiedOf<FullProfile>>();
+	template void VM::_loopThreaded<VerifiedOf<NoPrivilegeProfile>>();
+	template void VM::_loopThreaded<VerifiedOf<NoInterruptProfile>>();
+	template void VM::_loopThreaded<VerifiedOf<MinimalProfile>>();
+}	//sbl::vm
+
+#endif	//SBL_DIRECT_THREADED
@@ -0,0 +1,69 @@
+#include "../VM.hpp"
+#include "../Verifier.hpp"
+#include "../../common/Instruction.hpp"
+#include "../../common/OperandKinds.hpp"
+
+namespace sbl::vm {
+	namespace {
+		bool operandInRange(OperandKind kind, uint32_t arg, uint32_t registerCount, uint32_t fpRegisterCount) {
+			switch (kind) {
+				case OperandKind::Register:
+				case OperandKind::Indirect:
+					return arg < registerCount;
+				case OperandKind::FpRegister:
+					return arg < fpRegisterCount;
+				default:
+					return true;
+			}
+		}
+	}
+
+	/*
+		Verifies the program image, see Verifier.hpp.
+		The image has been decoded into decodedSegments already, so the mnemonics
+		are taken from there, and a jump target is executable if it lies in a decoded segment.
+	*/
+	Verification VM::_verify(uint32_t programBase, uint32_t programSize) {
+		Verification result;
+		result.result = VerifyResult::Verified;
+
+		auto segmentSize = static_cast<uint32_t>(memory.memory.getSegmentSize());
+		auto fail = [&result](VerifyResult why, uint32_t address) {
+			result.result = why;
+			result.address = address;
+			return result;
+		};
+
+		for (uint32_t address = programBase + decodeAlignment; address + 3 <= programBase + programSize; address += 3) {
+			auto instr = _fetchDecoded(address);
+			if (!instr)
+				return fail(VerifyResult::NonExecutableTarget, address);
+
+			if (!(instr->flags & DecodedInstruction::ValidMnemonic))
+				return fail(VerifyResult::InvalidMnemonic, address);
+
+			auto m = instr->instr.mnemonic;
+			auto kinds = operandKinds(m);
+			if (!operandInRange(kinds.first, instr->instr.arg1, static_cast<uint32_t>(registers.size()), static_cast<uint32_t>(fpregisters.size()))
+				|| !operandInRange(kinds.second, instr->instr.arg2, static_cast<uint32_t>(registers.size()), static_cast<uint32_t>(fpregisters.size())))
+				return fail(VerifyResult::InvalidRegisterId, address);
+
+			bool relative = isRelativeJump(m);
+			if (relative || isDirectJump(m)) {
+				//Relative jumps are taken from the address of the following instruction
+				uint32_t target = relative ? address + 3 + instr->instr.arg1 : instr->instr.arg1;
+				if (target % 3 != decodeAlignment)
+					return fail(VerifyResult::UnalignedTarget, address);
+
+				auto segId = target / segmentSize;
+				if (segId >= decodedSegments.size() || !decodedSegments[segId].enabled || target % segmentSize > segmentSize - 3)
+					return fail(VerifyResult::NonExecutableTarget, address);
+			}
+
+			++result.instructions;
+		}
+
+		return result;
+	}
+
+}	//sbl::vm
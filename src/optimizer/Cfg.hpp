@@ -0,0 +1,208 @@
+#pragma once
+
+#ifndef OPTIMIZER_CFG_HEADER_H_
+#define OPTIMIZER_CFG_HEADER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "ProgramImage.hpp"
+#include "../common/OperandKinds.hpp"
+
+namespace sbl::opt {
+	using cmn::OperandKind;
+
+	//How an instruction passes the control on
+	enum class Flow : uint8_t {
+		Next,		//Continues with the following instruction
+		Jump,		//Continues at its target
+		Branch,		//Continues either at its target or with the following instruction
+		Call,		//Continues at its target, and returns to the following instruction
+		Stop,		//Does not continue in this function(End, Halt, Ret, IRet, invalid mnemonics)
+		Unknown,	//Continues at an address computed at runtime
+	};
+
+	constexpr Flow flowOf(Mnemonic m) {
+		auto in = [m](Mnemonic first, Mnemonic last) {
+			return m >= first && m <= last;
+		};
+
+		switch (m) {
+			case Mnemonic::Halt:
+			case Mnemonic::End:
+			case Mnemonic::Ret:
+			case Mnemonic::IRet:
+				return Flow::Stop;
+			case Mnemonic::Jmp_A:
+			case Mnemonic::RJmp_A:
+				return Flow::Jump;
+			case Mnemonic::Call_A:
+			case Mnemonic::RCall_A:
+				return Flow::Call;
+			default:
+				break;
+		}
+
+		if (cmn::isDirectJump(m) || cmn::isRelativeJump(m))
+			return Flow::Branch;
+
+		if (in(Mnemonic::Call_R, Mnemonic::RCall_I)
+			|| in(Mnemonic::Jmp_R, Mnemonic::RJne_I)
+			|| in(Mnemonic::ExecInstr_A, Mnemonic::ExecInstr_I)
+			|| in(Mnemonic::Vcall_R_R, Mnemonic::RVcall_V_V)
+			|| in(Mnemonic::PCall_R_R, Mnemonic::RPCall_I_V))
+			return Flow::Unknown;
+
+		if (static_cast<uint32_t>(m) >= static_cast<uint32_t>(Mnemonic::TotalCount))
+			return Flow::Stop;
+
+		return Flow::Next;
+	}
+
+	//Whether the instruction depends on the addresses of the instructions in a way
+	//the optimizer cannot follow, so that no instruction of the program may move
+	//and no instruction may be assumed unreachable
+	inline bool pinsLayout(const Instruction& instr) {
+		auto m = instr.mnemonic;
+		if (flowOf(m) == Flow::Unknown)
+			return true;
+
+		//Code patching, interrupt handlers, and Pop_All restoring instrPtr
+		if ((m >= Mnemonic::Hotpatch_A_A && m <= Mnemonic::RHotpatch_I_I)
+			|| (m >= Mnemonic::RegInt_R_R && m <= Mnemonic::RRegInt_V_I)
+			|| m == Mnemonic::Push_All || m == Mnemonic::Pop_All)
+			return true;
+
+		//loopPtr and instrPtr hold code addresses
+		auto namesCode = [](OperandKind kind, uint32_t arg) {
+			return (kind == OperandKind::Register || kind == OperandKind::Indirect)
+				&& (arg == LoopPtrId || arg == InstrPtrId);
+		};
+
+		auto kinds = cmn::operandKinds(m);
+		return namesCode(kinds.first, instr.arg1) || namesCode(kinds.second, instr.arg2);
+	}
+
+	/*
+		Control flow graph of a program
+
+		Every instruction is a node with an optional target, the index of the instruction
+		its direct or relative jump goes to. Jumps out of the decoded instructions keep
+		their address in outside instead, Returns go to the instruction following
+		the Call they return from, and Endloop goes to the instruction following the Loop
+		it belongs to, so both of these start a block too.
+	*/
+	struct Node {
+		static constexpr size_t NoTarget = static_cast<size_t>(-1);
+
+		Instruction instr;
+		size_t target = NoTarget;
+		uint32_t outside = 0;
+		bool removed = false;
+
+		Flow flow() const {
+			return flowOf(instr.mnemonic);
+		}
+
+		bool hasTarget() const {
+			return target != NoTarget;
+		}
+	};
+
+	//Nodes of the instructions of the image, with the targets of their jumps resolved
+	inline std::vector<Node> decodeNodes(const ProgramImage& image) {
+		std::vector<Node> nodes;
+		nodes.reserve(image.code.size());
+		for (size_t i = 0; i < image.code.size(); ++i) {
+			Node node;
+			node.instr = image.code[i];
+
+			auto m = node.instr.mnemonic;
+			if (cmn::isDirectJump(m) || cmn::isRelativeJump(m)) {
+				uint32_t target = cmn::isDirectJump(m) ? node.instr.arg1 : image.addressOf(i + 1) + node.instr.arg1;
+				auto index = image.indexOf(target);
+				if (index < image.code.size() || target == image.addressOf(index))
+					node.target = index;
+				else
+					node.outside = target;
+			}
+
+			nodes.push_back(node);
+		}
+		return nodes;
+	}
+
+	class Cfg {
+	public:
+		struct Block {
+			size_t first;
+			size_t last;
+			std::vector<size_t> successors;
+			bool reachable = false;
+		};
+
+		std::vector<Block> blocks;
+		//Block of every node
+		std::vector<size_t> blockOf;
+
+		void build(const std::vector<Node>& nodes, size_t entry) {
+			blocks.clear();
+			blockOf.assign(nodes.size(), 0);
+			if (nodes.empty())
+				return;
+
+			std::vector<bool> leader(nodes.size() + 1, false);
+			leader[0] = true;
+			leader[std::min(entry, nodes.size())] = true;
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				auto& node = nodes[i];
+				if (node.hasTarget())
+					leader[node.target] = true;
+				if (node.flow() != Flow::Next || node.instr.mnemonic == Mnemonic::Loop)
+					leader[i + 1] = true;
+			}
+
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				if (leader[i])
+					blocks.push_back({ i, i, {} });
+				blocks.back().last = i;
+				blockOf[i] = blocks.size() - 1;
+			}
+
+			for (size_t b = 0; b < blocks.size(); ++b) {
+				auto& last = nodes[blocks[b].last];
+				auto flow = last.flow();
+				bool next = b + 1 < blocks.size();
+
+				if (last.hasTarget() && last.target < nodes.size())
+					blocks[b].successors.push_back(blockOf[last.target]);
+				if (next && (flow == Flow::Next || flow == Flow::Branch || flow == Flow::Call || flow == Flow::Unknown))
+					blocks[b].successors.push_back(b + 1);
+			}
+
+			if (entry < nodes.size())
+				_markReachable(blockOf[entry]);
+		}
+
+		bool isLeader(size_t index) const {
+			return blocks[blockOf[index]].first == index;
+		}
+
+	private:
+		void _markReachable(size_t from) {
+			std::vector<size_t> pending = { from };
+			while (!pending.empty()) {
+				auto b = pending.back();
+				pending.pop_back();
+				if (blocks[b].reachable)
+					continue;
+
+				blocks[b].reachable = true;
+				for (auto succ : blocks[b].successors)
+					pending.push_back(succ);
+			}
+		}
+	};
+}
+
+#endif	//OPTIMIZER_CFG_HEADER_H_
@@ -0,0 +1,337 @@
+#pragma once
+
+#ifndef OPTIMIZER_OPTIMIZER_HEADER_H_
+#define OPTIMIZER_OPTIMIZER_HEADER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "ProgramImage.hpp"
+#include "Cfg.hpp"
+
+namespace sbl::opt {
+	struct Stats {
+		size_t before = 0;			//Instructions of the input
+		size_t after = 0;			//Instructions of the output, not counting the ones replaced by Nop
+		size_t peephole = 0;		//Instructions removed or merged by the peephole pass
+		size_t threaded = 0;		//Jumps retargeted or replaced by the instruction they jump to
+		size_t unreachable = 0;		//Instructions removed as unreachable
+		bool keptLayout = false;	//Whether the instructions had to stay at their addresses
+		size_t pinnedAt = Node::NoTarget;
+									//Index of the first instruction that required keeping the layout
+	};
+
+	/*
+		Bytecode optimizer working on a whole program image
+
+		Programs whose control flow is fully known(no jumps or calls through registers or memory,
+		no code patching, no interrupt handlers, no use of instrPtr or loopPtr as an operand) get
+		compacted: the removed instructions are dropped and every direct and relative jump is
+		re-encoded for the new addresses.
+
+		Every other program keeps its layout, removed instructions are replaced by Nop in place
+		and only the rewrites that are correct for any entry into the code are done.
+	*/
+	class Optimizer {
+	public:
+		Optimizer(ProgramImage& image, bool keepLayout = false) : image(image) {
+			stats.keptLayout = keepLayout;
+		}
+
+		Stats run() {
+			_decode();
+			stats.before = nodes.size();
+
+			//Every pass can expose more work for the others
+			for (int round = 0; round < 16; ++round) {
+				bool changed = _peephole();
+				changed |= _threadJumps();
+				if (!stats.keptLayout)
+					changed |= _removeUnreachable();
+
+				if (!changed)
+					break;
+			}
+
+			_encode();
+			return stats;
+		}
+
+	private:
+		ProgramImage& image;
+		std::vector<Node> nodes;
+		size_t entry = 0;
+		Cfg cfg;
+		Stats stats;
+		size_t removed = 0;
+
+		void _pin(size_t index) {
+			if (!stats.keptLayout)
+				stats.pinnedAt = index;
+			stats.keptLayout = true;
+		}
+
+		void _decode() {
+			nodes = decodeNodes(image);
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				auto& node = nodes[i];
+				auto m = node.instr.mnemonic;
+
+				//Jumps into the middle of an instruction or into the words around them
+				//cannot be re-encoded
+				if ((cmn::isDirectJump(m) || cmn::isRelativeJump(m)) && !node.hasTarget() && image.isInProgram(node.outside))
+					_pin(i);
+
+				if (pinsLayout(node.instr))
+					_pin(i);
+			}
+
+			entry = image.entry();
+			if (entry >= nodes.size())
+				_pin(Node::NoTarget);
+		}
+
+		void _encode() {
+			image.code.clear();
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				auto instr = nodes[i].instr;
+				auto m = instr.mnemonic;
+				if (cmn::isDirectJump(m) || cmn::isRelativeJump(m)) {
+					uint32_t target = nodes[i].hasTarget() ? image.addressOf(nodes[i].target) : nodes[i].outside;
+					instr.arg1 = cmn::isDirectJump(m) ? target : target - image.addressOf(i + 1);
+				}
+
+				image.code.push_back(instr);
+			}
+
+			stats.after = stats.before - removed;
+			if (!stats.keptLayout)
+				image.header.startAddress = image.addressOf(entry) - image.programBase;
+		}
+
+		//Drops the removed nodes, jumps to a removed node go to the next one that is kept
+		void _erase() {
+			std::vector<size_t> newIndex(nodes.size() + 1);
+			size_t kept = 0;
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				newIndex[i] = kept;
+				kept += !nodes[i].removed;
+			}
+			newIndex[nodes.size()] = kept;
+
+			std::vector<Node> compacted;
+			compacted.reserve(kept);
+			for (auto& node : nodes) {
+				if (node.removed)
+					continue;
+				if (node.hasTarget())
+					node.target = newIndex[node.target];
+				compacted.push_back(node);
+			}
+
+			entry = newIndex[entry];
+			nodes = std::move(compacted);
+		}
+
+		void _remove(size_t index) {
+			++removed;
+			if (stats.keptLayout)
+				nodes[index] = Node{ { Mnemonic::Nop, 0, 0 } };
+			else
+				nodes[index].removed = true;
+		}
+
+		static bool _isWritableRegister(uint32_t id) {
+			return id < LoopPtrId;
+		}
+
+		bool _isNoop(size_t index) const {
+			auto& instr = nodes[index].instr;
+			switch (instr.mnemonic) {
+				case Mnemonic::Nop:
+					return !stats.keptLayout;
+				case Mnemonic::Mov_R_R:
+					return instr.arg1 == instr.arg2 && _isWritableRegister(instr.arg1);
+				case Mnemonic::Add_R_V:
+				case Mnemonic::Sub_R_V:
+				case Mnemonic::Or_R_V:
+				case Mnemonic::Xor_R_V:
+				case Mnemonic::Lsh_R_V:
+				case Mnemonic::Rsh_R_V:
+					return instr.arg2 == 0 && _isWritableRegister(instr.arg1);
+				case Mnemonic::Mul_R_V:
+					return instr.arg2 == 1 && _isWritableRegister(instr.arg1);
+				case Mnemonic::And_R_V:
+					return instr.arg2 == 0xFFFFFFFF && _isWritableRegister(instr.arg1);
+				default:
+					break;
+			}
+
+			//Jumps to the following instruction
+			auto flow = nodes[index].flow();
+			return (flow == Flow::Jump || flow == Flow::Branch) && nodes[index].target == index + 1;
+		}
+
+		//Merges the effect of first into second, if they can be done by a single instruction
+		static bool _merge(const Instruction& first, Instruction& second) {
+			auto reg = first.arg1;
+			if (!_isWritableRegister(reg) || second.arg1 != reg)
+				return false;
+
+			//The second one overwrites whatever the first one wrote
+			bool overwrites = second.mnemonic == Mnemonic::Mov_R_V
+				|| (second.mnemonic == Mnemonic::Mov_R_R && second.arg2 != reg && second.arg2 < RegisterCount);
+
+			switch (first.mnemonic) {
+				case Mnemonic::Mov_R_R:
+					if (first.arg2 >= RegisterCount)
+						return false;
+					[[fallthrough]];
+				case Mnemonic::Mov_R_V:
+				case Mnemonic::Add_R_V:
+				case Mnemonic::Sub_R_V:
+				case Mnemonic::Mul_R_V:
+				case Mnemonic::And_R_V:
+				case Mnemonic::Or_R_V:
+				case Mnemonic::Xor_R_V:
+				case Mnemonic::Lsh_R_V:
+				case Mnemonic::Rsh_R_V:
+					if (overwrites)
+						return true;
+					break;
+				default:
+					return false;
+			}
+
+			if (first.mnemonic == Mnemonic::Mov_R_V) {
+				uint32_t lhs = first.arg2;
+				uint32_t rhs = second.arg2;
+				uint32_t value;
+				switch (second.mnemonic) {
+					case Mnemonic::Add_R_V:	value = lhs + rhs;	break;
+					case Mnemonic::Sub_R_V:	value = lhs - rhs;	break;
+					case Mnemonic::Mul_R_V:	value = lhs * rhs;	break;
+					case Mnemonic::And_R_V:	value = lhs & rhs;	break;
+					case Mnemonic::Or_R_V:	value = lhs | rhs;	break;
+					case Mnemonic::Xor_R_V:	value = lhs ^ rhs;	break;
+					case Mnemonic::Lsh_R_V:
+						if (rhs >= 32)
+							return false;
+						value = lhs << rhs;
+						break;
+					case Mnemonic::Rsh_R_V:
+						if (rhs >= 32)
+							return false;
+						value = lhs >> rhs;
+						break;
+					default:
+						return false;
+				}
+
+				second = { Mnemonic::Mov_R_V, reg, value };
+				return true;
+			}
+
+			auto delta = [](const Instruction& instr, uint32_t& out) {
+				if (instr.mnemonic == Mnemonic::Add_R_V)
+					out = instr.arg2;
+				else if (instr.mnemonic == Mnemonic::Sub_R_V)
+					out = 0 - instr.arg2;
+				else
+					return false;
+				return true;
+			};
+
+			uint32_t firstDelta, secondDelta;
+			if (delta(first, firstDelta) && delta(second, secondDelta)) {
+				second = { Mnemonic::Add_R_V, reg, firstDelta + secondDelta };
+				return true;
+			}
+
+			return false;
+		}
+
+		bool _peephole() {
+			bool changed = false;
+			cfg.build(nodes, entry);
+
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				if (_isNoop(i)) {
+					_remove(i);
+					++stats.peephole;
+					changed = true;
+					continue;
+				}
+
+				//Code entered at an unknown address can land between the two instructions
+				if (stats.keptLayout || i + 1 == nodes.size() || cfg.isLeader(i + 1))
+					continue;
+
+				if (nodes[i].flow() == Flow::Next && _merge(nodes[i].instr, nodes[i + 1].instr)) {
+					_remove(i);
+					++stats.peephole;
+					changed = true;
+				}
+			}
+
+			if (!stats.keptLayout)
+				_erase();
+			return changed;
+		}
+
+		bool _threadJumps() {
+			bool changed = false;
+			for (size_t i = 0; i < nodes.size(); ++i) {
+				auto& node = nodes[i];
+				if (!node.hasTarget())
+					continue;
+
+				//Follow chains of unconditional jumps, chains ending in a cycle are left alone
+				auto target = node.target;
+				size_t steps = 0;
+				for (; steps <= nodes.size() && target < nodes.size()
+					&& nodes[target].flow() == Flow::Jump && nodes[target].hasTarget(); ++steps)
+					target = nodes[target].target;
+
+				if (steps > nodes.size())
+					continue;
+
+				if (target != node.target) {
+					node.target = target;
+					++stats.threaded;
+					changed = true;
+				}
+
+				//A jump to an instruction that ends the function does the same as the instruction
+				if (node.flow() == Flow::Jump && target < nodes.size() && nodes[target].flow() == Flow::Stop
+					&& nodes[target].instr.mnemonic < Mnemonic::TotalCount) {
+					node = nodes[target];
+					++stats.threaded;
+					changed = true;
+				}
+			}
+
+			return changed;
+		}
+
+		bool _removeUnreachable() {
+			cfg.build(nodes, entry);
+
+			bool changed = false;
+			for (auto& block : cfg.blocks) {
+				if (block.reachable)
+					continue;
+
+				for (auto i = block.first; i <= block.last; ++i)
+					_remove(i);
+				stats.unreachable += block.last - block.first + 1;
+				changed = true;
+			}
+
+			_erase();
+			return changed;
+		}
+	};
+}
+
+#endif	//OPTIMIZER_OPTIMIZER_HEADER_H_
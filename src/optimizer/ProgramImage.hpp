@@ -0,0 +1,115 @@
+#pragma once
+
+#ifndef OPTIMIZER_PROGRAM_IMAGE_HEADER_H_
+#define OPTIMIZER_PROGRAM_IMAGE_HEADER_H_
+
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "../interpreter/CompiledHeader.hpp"
+#include "../common/Instruction.hpp"
+
+namespace sbl::opt {
+	using cmn::Mnemonic;
+	using cmn::Instruction;
+
+	//Size of the segments of the VM, see Memory.hpp
+	constexpr uint32_t SegmentSize = 4096;
+	//Number of integer registers of the VM, see VM::registers
+	constexpr uint32_t RegisterCount = 64;
+	constexpr uint32_t LoopPtrId = 60;
+	constexpr uint32_t InstrPtrId = 62;
+
+	constexpr uint32_t HeaderSize = sizeof(vm::CompiledHeader) / sizeof(uint32_t);
+
+	/*
+		Program image split the same way the VM lays it out in the memory(see MemoryMap::initialize):
+			the header,
+			the globals, padded to whole segments, starting at the address 0,
+			the program, starting at programBase.
+
+		The program is split into instructions at the alignment of its entry point,
+		the words in front of the first instruction and behind the last one are kept as they are.
+	*/
+	struct ProgramImage {
+		vm::CompiledHeader header;
+		std::vector<uint32_t> globals;
+		std::vector<uint32_t> leading;
+		std::vector<Instruction> code;
+		std::vector<uint32_t> trailing;
+		uint32_t programBase = 0;
+
+		//Address of the instruction with the given index, index may be code.size()
+		uint32_t addressOf(size_t index) const {
+			return programBase + static_cast<uint32_t>(leading.size() + index * 3);
+		}
+
+		bool isInProgram(uint32_t address) const {
+			return address >= programBase && address - programBase < header.programSize;
+		}
+
+		//Index of the instruction starting at address, or code.size() if there is none
+		size_t indexOf(uint32_t address) const {
+			auto first = addressOf(0);
+			if (address < first || (address - first) % 3 || (address - first) / 3 >= code.size())
+				return code.size();
+			return (address - first) / 3;
+		}
+
+		size_t entry() const {
+			return indexOf(programBase + header.startAddress);
+		}
+
+		bool load(const std::vector<uint32_t>& stream) {
+			header.fromStream(stream);
+			if (!header.validate())
+				return false;
+
+			programBase = (header.staticBlockSize + SegmentSize - 1) / SegmentSize * SegmentSize;
+			if (static_cast<uint64_t>(HeaderSize) + programBase + header.programSize > stream.size())
+				return false;
+
+			auto program = stream.begin() + HeaderSize + programBase;
+			auto programEnd = program + header.programSize;
+			globals.assign(stream.begin() + HeaderSize, program);
+
+			auto alignment = std::min(header.startAddress % 3, header.programSize);
+			leading.assign(program, program + alignment);
+
+			code.clear();
+			auto at = program + alignment;
+			for (; programEnd - at >= 3; at += 3)
+				code.push_back({ static_cast<Mnemonic>(at[0]), at[1], at[2] });
+
+			trailing.assign(at, programEnd);
+			return true;
+		}
+
+		//Stream loadable by VM::run, the program gets padded to whole segments
+		std::vector<uint32_t> store() {
+			header.programSize = static_cast<uint32_t>(leading.size() + code.size() * 3 + trailing.size());
+
+			std::vector<uint32_t> stream = {
+				header.version, header.signature, header.startAddress, header.stackSize,
+				header.heapPtrCount, header.staticBlockSize, header.programSize, header.features,
+			};
+			stream.insert(stream.end(), header.padding.begin(), header.padding.end());
+			stream.insert(stream.end(), globals.begin(), globals.end());
+			stream.insert(stream.end(), leading.begin(), leading.end());
+			for (auto& instr : code) {
+				stream.push_back(static_cast<uint32_t>(instr.mnemonic));
+				stream.push_back(instr.arg1);
+				stream.push_back(instr.arg2);
+			}
+			stream.insert(stream.end(), trailing.begin(), trailing.end());
+
+			auto programWords = stream.size() - HeaderSize - globals.size();
+			stream.resize(stream.size() + (SegmentSize - programWords % SegmentSize) % SegmentSize, 0);
+			return stream;
+		}
+	};
+}
+
+#endif	//OPTIMIZER_PROGRAM_IMAGE_HEADER_H_
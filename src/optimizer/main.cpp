@@ -0,0 +1,90 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include "Optimizer.hpp"
+
+/*
+	sbl-opt, optimizes a compiled program image
+
+	Usage:
+		sbl-opt <input> <output> [--keep-layout]
+
+	--keep-layout keeps every instruction at its address even when the program
+	could be compacted, removed instructions are replaced by Nop.
+*/
+
+namespace {
+	bool readImage(const std::string& filename, std::vector<uint32_t>& words) {
+		namespace fs = std::filesystem;
+
+		std::error_code fe;
+		auto fsize = fs::file_size(fs::path{ filename }, fe);
+		if (fe || fsize < sizeof(sbl::vm::CompiledHeader))
+			return false;
+
+		std::ifstream file{ filename, std::ios_base::binary };
+		if (!file)
+			return false;
+
+		words.resize(fsize / 4);
+		file.read(reinterpret_cast<char*>(&words[0]), fsize);
+		return static_cast<bool>(file);
+	}
+
+	bool writeImage(const std::string& filename, const std::vector<uint32_t>& words) {
+		std::ofstream file{ filename, std::ios_base::binary };
+		if (!file)
+			return false;
+
+		file.write(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(uint32_t));
+		return static_cast<bool>(file);
+	}
+}
+
+int main(int argc, char** argv) {
+	using namespace sbl::opt;
+
+	if (argc < 3 || argc > 4 || (argc == 4 && std::string_view{ argv[3] } != "--keep-layout")) {
+		std::cerr << "Usage: sbl-opt <input> <output> [--keep-layout]\n";
+		return 2;
+	}
+
+	std::vector<uint32_t> words;
+	if (!readImage(argv[1], words)) {
+		std::cerr << "sbl-opt: cannot read " << argv[1] << "\n";
+		return 1;
+	}
+
+	ProgramImage image;
+	if (!image.load(words)) {
+		std::cerr << "sbl-opt: " << argv[1] << " is not a valid program image\n";
+		return 1;
+	}
+
+	Optimizer optimizer{ image, argc == 4 };
+	auto stats = optimizer.run();
+
+	if (!writeImage(argv[2], image.store())) {
+		std::cerr << "sbl-opt: cannot write " << argv[2] << "\n";
+		return 1;
+	}
+
+	std::cout << "instructions: " << stats.before << " -> " << stats.after
+			  << " (" << stats.before - stats.after << " saved)\n"
+			  << "  peephole:       " << stats.peephole << "\n"
+			  << "  jump threading: " << stats.threaded << "\n"
+			  << "  unreachable:    " << stats.unreachable << "\n";
+
+	if (stats.keptLayout) {
+		std::cout << "layout kept";
+		if (stats.pinnedAt != Node::NoTarget)
+			std::cout << ", the instruction at 0x" << std::hex << image.addressOf(stats.pinnedAt) << std::dec
+					  << " needs the instructions at their addresses";
+		std::cout << "\n";
+	}
+
+	return 0;
+}